@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include <nanobench.h>
+
+namespace saucer::benchmarks
+{
+    using benchmark = std::function<void(ankerl::nanobench::Bench &)>;
+
+    inline auto &registry()
+    {
+        static std::vector<std::pair<std::string, benchmark>> instance;
+        return instance;
+    }
+
+    struct suite
+    {
+        suite(std::string name, benchmark callback)
+        {
+            registry().emplace_back(std::move(name), std::move(callback));
+        }
+    };
+} // namespace saucer::benchmarks
@@ -0,0 +1,44 @@
+#include "bench.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <iostream>
+#include <filesystem>
+
+int main(int argc, char **argv)
+{
+    namespace fs = std::filesystem;
+    using ankerl::nanobench::Result;
+
+    std::vector<Result> results;
+
+    for (auto &[name, callback] : saucer::benchmarks::registry())
+    {
+        auto bench = ankerl::nanobench::Bench{}.title(name).relative(true);
+        std::invoke(callback, bench);
+
+        std::ranges::copy(bench.results(), std::back_inserter(results));
+    }
+
+    if (argc < 2)
+    {
+        return 0;
+    }
+
+    const fs::path path{argv[1]};
+    std::ofstream output{path};
+
+    if (!output)
+    {
+        std::cerr << "Failed to open " << path << std::endl;
+        return 1;
+    }
+
+    const auto *format = path.extension() == ".csv" ? ankerl::nanobench::templates::csv() //
+                                                     : ankerl::nanobench::templates::json();
+
+    ankerl::nanobench::render(format, results, output);
+
+    return 0;
+}
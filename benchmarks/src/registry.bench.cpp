@@ -0,0 +1,107 @@
+#include "bench.hpp"
+
+#include <saucer/utils/hash.hpp>
+#include <saucer/utils/snapshot.hpp>
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+
+#include <fmt/core.h>
+
+namespace
+{
+    using namespace saucer;
+    using ankerl::nanobench::Bench;
+
+    constexpr auto count      = 64uz;
+    constexpr auto iterations = 10'000uz;
+
+    struct locked_registry
+    {
+        std::mutex mutex;
+        string_map<std::size_t> functions;
+
+      public:
+        std::size_t find(std::string_view name)
+        {
+            std::lock_guard guard{mutex};
+            return functions.find(std::string{name})->second;
+        }
+    };
+
+    struct snapshot_registry
+    {
+        snapshot<string_map<std::size_t>> functions;
+
+      public:
+        std::size_t find(std::string_view name) const
+        {
+            return functions.load()->find(name)->second;
+        }
+    };
+
+    const auto &names()
+    {
+        static const auto rtn = []
+        {
+            std::array<std::string, count> rtn;
+
+            for (auto i = 0uz; count > i; ++i)
+            {
+                rtn[i] = fmt::format("function_{}", i);
+            }
+
+            return rtn;
+        }();
+
+        return rtn;
+    }
+
+    template <typename T>
+    void contend(Bench &bench, std::string_view name, T &registry, std::size_t threads)
+    {
+        auto work = [&registry]
+        {
+            for (auto i = 0uz; iterations > i; ++i)
+            {
+                ankerl::nanobench::doNotOptimizeAway(registry.find(names()[i % count]));
+            }
+        };
+
+        auto run = [&]
+        {
+            std::vector<std::jthread> workers;
+
+            for (auto i = 0uz; threads > i; ++i)
+            {
+                workers.emplace_back(work);
+            }
+        };
+
+        bench.batch(threads * iterations).run(fmt::format("{} ({} threads)", name, threads), run);
+    }
+
+    void lookup(Bench &bench)
+    {
+        locked_registry locked;
+        snapshot_registry snapshotted;
+
+        for (auto i = 0uz; count > i; ++i)
+        {
+            locked.functions.emplace(names()[i], i);
+            snapshotted.functions.update([i](auto &functions) { functions.emplace(names()[i], i); });
+        }
+
+        const auto hardware = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+        for (const auto threads : {1uz, 4uz, hardware})
+        {
+            contend(bench, "lock", locked, threads);
+            contend(bench, "snapshot", snapshotted, threads);
+        }
+    }
+} // namespace
+
+static saucer::benchmarks::suite lookup_suite{"exposed function lookup", lookup};
@@ -0,0 +1,221 @@
+#include "bench.hpp"
+
+#include <saucer/config.hpp>
+
+#include <tuple>
+#include <future>
+#include <numeric>
+#include <optional>
+
+#include <fmt/core.h>
+
+namespace
+{
+    using namespace saucer;
+    using ankerl::nanobench::Bench;
+
+    struct point
+    {
+        double x;
+        double y;
+    };
+
+    struct node
+    {
+        std::string name;
+        std::vector<point> points;
+        std::optional<std::string> tag;
+    };
+
+    struct small
+    {
+        using params = std::tuple<int, double, std::string>;
+
+      public:
+        static params make()
+        {
+            return {42, 3.5, "hello"};
+        }
+
+        static auto function()
+        {
+            return [](int a, double b, const std::string &c)
+            {
+                return a + b + static_cast<double>(c.size());
+            };
+        }
+    };
+
+    struct nested
+    {
+        using params = std::tuple<std::vector<node>>;
+
+      public:
+        static params make()
+        {
+            std::vector<node> rtn(16);
+
+            for (auto i = 0uz; rtn.size() > i; ++i)
+            {
+                rtn[i].name   = fmt::format("node_{}", i);
+                rtn[i].points = std::vector<point>(8, point{.x = 1.5 * i, .y = -0.5 * i});
+                rtn[i].tag    = i % 2 ? std::optional<std::string>{"odd"} : std::nullopt;
+            }
+
+            return {std::move(rtn)};
+        }
+
+        static auto function()
+        {
+            return [](const std::vector<node> &nodes)
+            {
+                return std::accumulate(nodes.begin(), nodes.end(), 0uz,
+                                       [](auto sum, const auto &node) { return sum + node.points.size(); });
+            };
+        }
+    };
+
+    struct large
+    {
+        using params = std::tuple<std::vector<double>>;
+
+      public:
+        static params make()
+        {
+            // 1 MiB worth of doubles
+            std::vector<double> rtn((1024 * 1024) / sizeof(double));
+            std::iota(rtn.begin(), rtn.end(), 0.25);
+
+            return {std::move(rtn)};
+        }
+
+        static auto function()
+        {
+            return [](const std::vector<double> &values)
+            {
+                return std::accumulate(values.begin(), values.end(), 0.0);
+            };
+        }
+    };
+
+    template <typename F, typename R, typename I>
+    auto deduce(const serializers::generic::serializer<F, R, I> &) -> std::tuple<F, R, I>;
+
+    template <typename Serializer, std::size_t I>
+    using part = std::tuple_element_t<I, decltype(deduce(std::declval<Serializer>()))>;
+
+    template <typename Interface>
+    struct wire
+    {
+        template <typename T>
+        static std::string call(std::uint64_t id, const T &params)
+        {
+            static constexpr auto format = R"({{"saucer:call":true,"id":{},"name":"bench","params":{}}})";
+            return fmt::format(format, id, Interface::serialize(params));
+        }
+
+        template <typename T>
+        static std::string resolve(std::uint64_t id, const T &result)
+        {
+            static constexpr auto format = R"({{"saucer:resolve":true,"id":{},"result":{}}})";
+            return fmt::format(format, id, Interface::serialize(result));
+        }
+    };
+
+#ifdef SAUCER_BENCHMARK_MSGPACK
+    template <>
+    struct wire<serializers::msgpack::interface>
+    {
+        template <typename T>
+        static std::string call(std::uint64_t id, const T &params)
+        {
+            const auto bytes = rfl::msgpack::write(std::make_tuple(id, std::string{"bench"}, params));
+            return fmt::format("saucer:call;{}", serializers::msgpack::impl::encode(bytes));
+        }
+
+        template <typename T>
+        static std::string resolve(std::uint64_t id, const T &result)
+        {
+            const auto bytes = rfl::msgpack::write(std::make_tuple(id, result));
+            return fmt::format("saucer:resolve;{}", serializers::msgpack::impl::encode(bytes));
+        }
+    };
+#endif
+
+    template <typename Payload, typename Serializer = default_serializer>
+    void measure(Bench &bench)
+    {
+        if constexpr (!std::is_void_v<Serializer>)
+        {
+            using params        = Payload::params;
+            using result        = std::tuple_element_t<0, params>;
+            using function_data = part<Serializer, 0>;
+            using interface     = part<Serializer, 2>;
+
+            const Serializer instance;
+
+            const auto value      = Payload::make();
+            const auto call       = wire<interface>::call(1, value);
+            const auto resolution = wire<interface>::resolve(1, std::get<0>(value));
+
+            bench.run("parse_call",
+                      [&] { ankerl::nanobench::doNotOptimizeAway(instance.parse_call(message{call})); });
+
+            const auto data = instance.parse_call(message{call});
+
+            bench.run("parse",
+                      [&]
+                      {
+                          auto parsed = interface::template parse<params>(*static_cast<const function_data *>(data.get()));
+                          ankerl::nanobench::doNotOptimizeAway(parsed);
+                      });
+
+            bench.run("serialize_args",
+                      [&]
+                      {
+                          auto serialize = [](const auto &...args) { return Serializer::serialize_args(args...); };
+                          ankerl::nanobench::doNotOptimizeAway(std::apply(serialize, value));
+                      });
+
+            bench.run("resolve",
+                      [&]
+                      {
+                          std::promise<result> promise;
+                          auto future = promise.get_future();
+
+                          std::invoke(Serializer::resolve(std::move(promise)), instance.parse_resolve(message{resolution}));
+                          ankerl::nanobench::doNotOptimizeAway(future.get());
+                      });
+
+            auto function = Payload::function();
+
+            bench.run("trampoline (direct)",
+                      [&]
+                      {
+                          auto data   = instance.parse_call(message{call});
+                          auto parsed = interface::template parse<params>(*static_cast<const function_data *>(data.get()));
+
+                          ankerl::nanobench::doNotOptimizeAway(interface::serialize(std::apply(function, parsed.value())));
+                      });
+
+            auto trampoline = Serializer::serialize(Payload::function());
+
+            bench.run("trampoline",
+                      [&]
+                      {
+                          std::string rtn;
+
+                          auto resolve  = [&rtn](std::string value) { rtn = std::move(value); };
+                          auto reject   = [&rtn](std::string value) { rtn = std::move(value); };
+                          auto executor = serializer::executor{{std::move(resolve), std::move(reject)}, {}};
+
+                          std::invoke(trampoline, instance.parse_call(message{call}), std::move(executor));
+                          ankerl::nanobench::doNotOptimizeAway(rtn);
+                      });
+        }
+    }
+} // namespace
+
+static saucer::benchmarks::suite small_suite{"serializer (small scalars)", measure<small>};
+static saucer::benchmarks::suite nested_suite{"serializer (nested structs)", measure<nested>};
+static saucer::benchmarks::suite large_suite{"serializer (1 MiB array)", measure<large>};
@@ -11,6 +11,7 @@
 #include <string>
 #include <memory>
 #include <thread>
+#include <chrono>
 
 #include <poolparty/pool.hpp>
 
@@ -72,6 +73,7 @@ namespace saucer
 
       public:
         void post(callback_t) const;
+        void post(callback_t, std::chrono::milliseconds delay) const;
 
       public:
         template <bool Get = true, typename Callback>
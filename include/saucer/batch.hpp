@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <chrono>
+#include <memory>
+#include <cstddef>
+
+#include <functional>
+
+namespace saucer
+{
+    struct application;
+
+    struct batch_options
+    {
+        std::size_t max_size{256};
+        std::chrono::milliseconds latency{0};
+    };
+
+    class batch
+    {
+        struct impl;
+
+      public:
+        using callback = std::move_only_function<bool(const std::vector<std::string> &)>;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        batch(application *, batch_options, callback);
+
+      public:
+        ~batch();
+
+      public:
+        [[sc::thread_safe]] void push(std::string entry);
+        [[sc::thread_safe]] void flush();
+    };
+} // namespace saucer
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "stash/stash.hpp"
+
+#include <span>
+#include <array>
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstdint>
+
+#include <ranges>
+#include <variant>
+#include <optional>
+#include <concepts>
+#include <string_view>
+
+namespace saucer::bridge
+{
+    struct blob
+    {
+        std::string id;
+    };
+
+    class blobs
+    {
+        struct impl;
+
+      private:
+        std::unique_ptr<impl> m_impl;
+
+      public:
+        static constexpr std::size_t limit = 256 * 1024 * 1024;
+
+      public:
+        blobs();
+
+      public:
+        ~blobs();
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::optional<std::string> store(stash<>);
+        [[sc::thread_safe]] [[nodiscard]] std::optional<stash<>> take(const std::string &);
+
+      public:
+        [[sc::thread_safe]] void clear();
+    };
+
+    namespace impl
+    {
+        template <typename T>
+        struct typed_array;
+
+        template <>
+        struct typed_array<std::uint8_t>
+        {
+            static constexpr std::string_view name = "Uint8Array";
+        };
+
+        template <>
+        struct typed_array<std::int8_t>
+        {
+            static constexpr std::string_view name = "Int8Array";
+        };
+
+        template <>
+        struct typed_array<std::uint16_t>
+        {
+            static constexpr std::string_view name = "Uint16Array";
+        };
+
+        template <>
+        struct typed_array<std::int16_t>
+        {
+            static constexpr std::string_view name = "Int16Array";
+        };
+
+        template <>
+        struct typed_array<std::uint32_t>
+        {
+            static constexpr std::string_view name = "Uint32Array";
+        };
+
+        template <>
+        struct typed_array<std::int32_t>
+        {
+            static constexpr std::string_view name = "Int32Array";
+        };
+
+        template <>
+        struct typed_array<float>
+        {
+            static constexpr std::string_view name = "Float32Array";
+        };
+
+        template <>
+        struct typed_array<double>
+        {
+            static constexpr std::string_view name = "Float64Array";
+        };
+
+        template <typename T>
+        struct is_owning : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_owning<std::vector<T>> : std::true_type
+        {
+        };
+
+        template <typename T, std::size_t N>
+        struct is_owning<std::array<T, N>> : std::true_type
+        {
+        };
+    } // namespace impl
+
+    template <typename T>
+    concept Numeric = requires() { impl::typed_array<std::remove_cv_t<T>>::name; };
+
+    template <typename T>
+    concept Contiguous = std::ranges::contiguous_range<T> && std::ranges::sized_range<T> &&
+                         Numeric<std::ranges::range_value_t<T>>;
+
+    // Numeric containers reach JavaScript as plain arrays, wrapping them opts into the matching typed array instead.
+
+    template <Contiguous T>
+    struct typed
+    {
+        T value;
+    };
+
+    namespace impl
+    {
+        template <typename T>
+        struct is_typed : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct is_typed<typed<T>> : std::true_type
+        {
+        };
+    } // namespace impl
+
+    template <typename T>
+    concept Bytes = std::same_as<T, std::vector<std::uint8_t>> || std::same_as<T, std::span<std::uint8_t>> ||
+                    std::same_as<T, std::span<const std::uint8_t>>;
+
+    template <typename T, typename U = std::remove_cvref_t<T>>
+    concept Binary = std::same_as<U, stash<>> || Bytes<U> || impl::is_typed<U>::value;
+
+    template <typename T>
+    struct wire
+    {
+        using type = T;
+    };
+
+    template <>
+    struct wire<stash<>>
+    {
+        using type = blob;
+    };
+
+    template <>
+    struct wire<std::vector<std::uint8_t>>
+    {
+        using type = std::variant<std::vector<std::uint8_t>, blob>;
+    };
+
+    template <typename T>
+        requires impl::is_owning<T>::value
+    struct wire<typed<T>>
+    {
+        using type = std::variant<T, blob>;
+    };
+
+    template <typename T>
+    using wire_t = wire<T>::type;
+
+    [[nodiscard]] std::string encode(std::span<const std::uint8_t>);
+
+    template <Binary T>
+    [[nodiscard]] stash<> pack(T &&);
+
+    template <typename T>
+    [[nodiscard]] std::optional<T> unwire(blobs &, wire_t<T> &&);
+
+    template <Binary T>
+    [[nodiscard]] std::string expression(blobs &, T &&);
+
+    template <Binary T>
+    [[nodiscard]] std::string literal(T &&);
+} // namespace saucer::bridge
+
+namespace saucer
+{
+    using bridge::typed;
+} // namespace saucer
+
+#include "bridge.inl"
@@ -0,0 +1,206 @@
+#pragma once
+
+#include "bridge.hpp"
+#include "utils/overload.hpp"
+
+#include <memory>
+#include <cstring>
+
+#include <fmt/core.h>
+
+namespace saucer::bridge
+{
+    namespace impl
+    {
+        template <typename T>
+        struct contained
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        struct contained<typed<T>>
+        {
+            using type = T;
+        };
+
+        template <typename T>
+        using contained_t = contained<T>::type;
+
+        template <typename T>
+        using element_t = std::remove_cv_t<std::ranges::range_value_t<T>>;
+
+        template <typename T>
+        constexpr std::string_view name()
+        {
+            if constexpr (is_typed<T>::value)
+            {
+                return typed_array<element_t<contained_t<T>>>::name;
+            }
+            else
+            {
+                return typed_array<std::uint8_t>::name;
+            }
+        }
+
+        template <typename T>
+        std::span<const std::uint8_t> bytes(const T &value)
+        {
+            if constexpr (std::same_as<T, stash<>>)
+            {
+                return {value.data(), value.size()};
+            }
+            else if constexpr (is_typed<T>::value)
+            {
+                return bytes(value.value);
+            }
+            else
+            {
+                const auto *data = reinterpret_cast<const std::uint8_t *>(std::ranges::data(value));
+                return {data, std::ranges::size(value) * sizeof(element_t<T>)};
+            }
+        }
+
+        template <typename T>
+        std::optional<T> unpack(const stash<> &content)
+        {
+            using element = element_t<T>;
+
+            if (content.size() % sizeof(element) != 0)
+            {
+                return std::nullopt;
+            }
+
+            const auto count = content.size() / sizeof(element);
+            auto rtn         = T{};
+
+            if constexpr (requires { rtn.resize(count); })
+            {
+                rtn.resize(count);
+            }
+            else if (rtn.size() != count)
+            {
+                return std::nullopt;
+            }
+
+            if (count > 0)
+            {
+                std::memcpy(rtn.data(), content.data(), content.size());
+            }
+
+            return rtn;
+        }
+    } // namespace impl
+
+    template <Binary T>
+    stash<> pack(T &&value)
+    {
+        using type = std::remove_cvref_t<T>;
+
+        if constexpr (std::same_as<type, stash<>>)
+        {
+            return std::forward<T>(value);
+        }
+        else if constexpr (std::same_as<type, std::vector<std::uint8_t>>)
+        {
+            return stash<>::from(std::forward<T>(value));
+        }
+        else
+        {
+            using inner = impl::contained_t<type>;
+            using owner = std::conditional_t<impl::is_owning<inner>::value, inner, std::vector<impl::element_t<inner>>>;
+
+            // The stash views the bytes of the container it keeps alive, moved-in containers are never copied.
+
+            struct holder
+            {
+                owner data;
+                std::optional<stash<>> view;
+            };
+
+            auto make = [&]
+            {
+                auto &&data = [&]() -> auto &&
+                {
+                    if constexpr (impl::is_typed<type>::value)
+                    {
+                        return std::forward<T>(value).value;
+                    }
+                    else
+                    {
+                        return std::forward<T>(value);
+                    }
+                }();
+
+                if constexpr (impl::is_owning<inner>::value)
+                {
+                    return std::make_shared<holder>(owner(std::forward<decltype(data)>(data)));
+                }
+                else
+                {
+                    return std::make_shared<holder>(owner(std::ranges::begin(data), std::ranges::end(data)));
+                }
+            };
+
+            auto held = make();
+
+            held->view.emplace(stash<>::view(impl::bytes(held->data)));
+
+            return stash<>::shared({held, &held->view.value()});
+        }
+    }
+
+    template <typename T>
+    std::optional<T> unwire(blobs &store, wire_t<T> &&value)
+    {
+        if constexpr (std::same_as<T, stash<>>)
+        {
+            return store.take(value.id);
+        }
+        else if constexpr (!std::same_as<wire_t<T>, T>)
+        {
+            using inner = impl::contained_t<T>;
+
+            overload visitor = {
+                [](inner &data) -> std::optional<inner> { return std::move(data); },
+                [&store](const blob &data) -> std::optional<inner>
+                { return store.take(data.id).and_then(impl::unpack<inner>); },
+            };
+
+            if constexpr (impl::is_typed<T>::value)
+            {
+                return std::visit(visitor, value).transform([](inner &&data) { return T{std::move(data)}; });
+            }
+            else
+            {
+                return std::visit(visitor, value);
+            }
+        }
+        else
+        {
+            return std::move(value);
+        }
+    }
+
+    template <Binary T>
+    std::string expression(blobs &store, T &&value)
+    {
+        static constexpr auto name = impl::name<std::remove_cvref_t<T>>();
+
+        auto id = store.store(pack(std::forward<T>(value)));
+
+        if (!id)
+        {
+            return R"(Promise.reject(new Error("Binary data exceeds the blob store limit")))";
+        }
+
+        return fmt::format(R"(window.saucer.internal.blob("{}", "{}"))", id.value(), name);
+    }
+
+    template <Binary T>
+    std::string literal(T &&value)
+    {
+        static constexpr auto name = impl::name<std::remove_cvref_t<T>>();
+        return fmt::format(R"(window.saucer.internal.typed("{}", "{}"))", name, encode(impl::bytes(value)));
+    }
+} // namespace saucer::bridge
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "scheme.hpp"
+#include "stash/stash.hpp"
+
+#include <string>
+#include <memory>
+#include <expected>
+#include <string_view>
+#include <unordered_map>
+
+namespace saucer
+{
+    struct embedded_file
+    {
+        stash<> content;
+        std::string mime;
+
+      public:
+        std::string encoding{};
+    };
+
+    class embedded_store
+    {
+        struct impl;
+        struct table;
+        struct source;
+
+      public:
+        using files = std::unordered_map<std::string, embedded_file>;
+
+      private:
+        using catalog = std::unordered_map<std::string, source>;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        embedded_store();
+
+      public:
+        ~embedded_store();
+
+      public:
+        [[sc::thread_safe]] void add(files);
+        [[sc::thread_safe]] void remove(const std::string &file);
+        [[sc::thread_safe]] void clear();
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::expected<std::shared_ptr<const scheme::response>, scheme::error> find(
+            std::string_view file, const scheme::request &) const;
+    };
+} // namespace saucer
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+#include <functional>
+
+namespace saucer
+{
+    struct application;
+
+    enum class coalesce : std::uint8_t
+    {
+        none,
+        latest,
+    };
+
+    class emitter
+    {
+        struct impl;
+
+      public:
+        using callback = std::move_only_function<bool(std::string)>;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        static constexpr std::size_t limit = 4096;
+
+      public:
+        emitter(application *, callback);
+
+      public:
+        ~emitter();
+
+      public:
+        [[sc::thread_safe]] bool push(std::string channel, std::string payload, coalesce policy);
+
+      public:
+        [[sc::thread_safe]] void acknowledge();
+        [[sc::thread_safe]] void reset();
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::size_t pending() const;
+    };
+} // namespace saucer
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <functional>
 
 namespace saucer
@@ -29,4 +30,19 @@ namespace saucer
         std::function<impl::fn_with_arg_t<void, T>> resolve;
         std::function<impl::fn_with_arg_t<void, E>> reject;
     };
+
+    enum class stream_status : std::uint8_t
+    {
+        accepted,
+        full,
+        closed,
+    };
+
+    template <typename T, typename E = std::string>
+    struct stream
+    {
+        std::function<stream_status(T)> yield;
+        std::function<void()> finish;
+        std::function<impl::fn_with_arg_t<void, E>> reject;
+    };
 } // namespace saucer
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <memory>
+
+#include <string_view>
+
+namespace saucer
+{
+    class message
+    {
+        std::shared_ptr<const void> m_owner;
+        std::string_view m_data;
+
+      public:
+        message();
+        message(std::string);
+        message(std::string_view, std::shared_ptr<const void> owner);
+
+      public:
+        [[nodiscard]] std::string_view data() const;
+        [[nodiscard]] operator std::string_view() const;
+    };
+} // namespace saucer
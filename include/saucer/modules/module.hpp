@@ -7,6 +7,8 @@
 #include <optional>
 #include <string>
 
+#include "../message.hpp"
+
 #include <eraser/erased.hpp>
 
 namespace saucer
@@ -25,7 +27,7 @@ namespace saucer
                                                                  return false;
                                                              }
                                                          },
-                                                         bool(const std::string &)>>;
+                                                         bool(const message &)>>;
     } // namespace modules
 
     template <typename T>
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "message.hpp"
+#include "utils/hash.hpp"
+
+#include <string>
+#include <optional>
+#include <functional>
+
+#include <string_view>
+
+namespace saucer
+{
+    class router
+    {
+      public:
+        using handler = std::move_only_function<bool(const message &)>;
+
+      private:
+        string_map<handler> m_routes;
+
+      public:
+        void add(std::string tag, handler);
+        void remove(std::string_view tag);
+
+      public:
+        [[nodiscard]] bool contains(std::string_view tag) const;
+        [[nodiscard]] std::optional<bool> route(std::string_view tag, const message &);
+
+      public:
+        [[nodiscard]] static std::optional<std::string_view> tag(std::string_view message);
+    };
+} // namespace saucer
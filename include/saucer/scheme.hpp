@@ -6,6 +6,9 @@
 #include <map>
 #include <string>
 #include <memory>
+#include <cstddef>
+#include <optional>
+#include <functional>
 
 namespace saucer::scheme
 {
@@ -18,6 +21,35 @@ namespace saucer::scheme
         failed,
     };
 
+    struct reader
+    {
+        std::size_t size;
+        std::function<stash<>(std::size_t offset, std::size_t length)> read;
+    };
+
+    class writer
+    {
+      public:
+        struct impl;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+        std::shared_ptr<void> m_guard;
+
+      public:
+        static constexpr std::size_t default_capacity = 4 * 1024 * 1024;
+
+      public:
+        writer(std::size_t capacity = default_capacity);
+
+      public:
+        [[sc::thread_safe]] [[sc::may_block]] bool write(stash<> chunk);
+        [[sc::thread_safe]] void finish();
+
+      public:
+        [[nodiscard]] std::shared_ptr<impl> native() const;
+    };
+
     struct response
     {
         stash<> data;
@@ -26,6 +58,10 @@ namespace saucer::scheme
 
       public:
         int status{200};
+
+      public:
+        std::optional<reader> ranged{};
+        std::optional<writer> stream{};
     };
 
     class request
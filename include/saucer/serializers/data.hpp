@@ -2,22 +2,30 @@
 
 #include <string>
 #include <memory>
-
-#include <variant>
 #include <cstdint>
+#include <variant>
 
 namespace saucer
 {
+    namespace bridge
+    {
+        class blobs;
+    } // namespace bridge
+
     struct function_data
     {
         std::uint64_t id;
-        std::string name;
+        std::variant<std::uint64_t, std::string> name;
+
+      public:
+        std::shared_ptr<bridge::blobs> blobs{};
     };
 
     struct result_data
     {
         std::uint64_t id;
-    };
 
-    using message_data = std::variant<std::unique_ptr<function_data>, std::unique_ptr<result_data>, std::monostate>;
+      public:
+        std::shared_ptr<bridge::blobs> blobs{};
+    };
 } // namespace saucer
@@ -2,6 +2,7 @@
 
 #include "generic.hpp"
 
+#include "../../bridge.hpp"
 #include "../../utils/tuple.hpp"
 #include "../../utils/traits.hpp"
 
@@ -34,7 +35,108 @@ namespace saucer::serializers::generic
         template <typename Interface, typename T>
         auto serialize(T &&data)
         {
-            return Interface::serialize(std::forward<T>(data));
+            if constexpr (bridge::Binary<std::remove_cvref_t<T>>)
+            {
+                return bridge::literal(std::forward<T>(data));
+            }
+            else
+            {
+                return Interface::serialize(std::forward<T>(data));
+            }
+        }
+
+        template <typename Interface, typename... Ts>
+        std::string serialize_result([[maybe_unused]] bridge::blobs *blobs, Ts &&...data)
+        {
+            if constexpr (sizeof...(Ts) == 1 && (bridge::Binary<std::remove_cvref_t<Ts>> && ...))
+            {
+                if (!blobs)
+                {
+                    return bridge::literal(std::forward<Ts>(data)...);
+                }
+
+                return bridge::expression(*blobs, std::forward<Ts>(data)...);
+            }
+            else
+            {
+                return std::string{serialize<Interface>(std::forward<Ts>(data)...)};
+            }
+        }
+
+        template <typename Interface, typename T>
+        std::expected<T, std::string> parse_result(const auto &data)
+        {
+            using wire = bridge::wire_t<T>;
+
+            if constexpr (std::same_as<wire, T>)
+            {
+                return parse<Interface, T>(data);
+            }
+            else
+            {
+                auto parsed = parse<Interface, wire>(data);
+
+                if (!parsed)
+                {
+                    return std::unexpected{parsed.error()};
+                }
+
+                if (!data.blobs)
+                {
+                    return std::unexpected{std::string{"Binary data requires a blob store"}};
+                }
+
+                auto rtn = bridge::unwire<T>(*data.blobs, std::move(parsed.value()));
+
+                if (!rtn)
+                {
+                    return std::unexpected{std::string{"Referenced binary data is no longer available"}};
+                }
+
+                return std::move(rtn.value());
+            }
+        }
+
+        template <typename Interface, tuple::Tuple T>
+        std::expected<T, std::string> parse_args(const auto &data)
+        {
+            using wire = tuple::transform_t<T, bridge::wire_t>;
+
+            if constexpr (std::same_as<wire, T>)
+            {
+                return parse<Interface, T>(data);
+            }
+            else
+            {
+                auto parsed = parse<Interface, wire>(data);
+
+                if (!parsed)
+                {
+                    return std::unexpected{parsed.error()};
+                }
+
+                if (!data.blobs)
+                {
+                    return std::unexpected{std::string{"Binary data requires a blob store"}};
+                }
+
+                auto &blobs = *data.blobs;
+
+                auto unpack = [&]<auto... Is>(std::index_sequence<Is...>) -> std::expected<T, std::string>
+                {
+                    auto unwired = std::make_tuple(
+                        bridge::unwire<std::tuple_element_t<Is, T>>(blobs, std::move(std::get<Is>(parsed.value())))...);
+
+                    if (!(std::get<Is>(unwired).has_value() && ...))
+                    {
+                        return std::unexpected{std::string{"Referenced binary data is no longer available"}};
+                    }
+
+                    return T{std::move(std::get<Is>(unwired).value())...};
+                };
+
+                return unpack(std::make_index_sequence<std::tuple_size_v<T>>());
+            }
         }
 
         template <typename Interface, Arguments T>
@@ -65,27 +167,49 @@ namespace saucer::serializers::generic
                                                             serializer::executor exec) mutable
         {
             const auto &message = *static_cast<FunctionData *>(data.get());
-            auto parsed         = impl::parse<Interface, args>(message);
+            auto parsed         = impl::parse_args<Interface, args>(message);
 
             if (!parsed)
             {
                 return std::invoke(exec.reject, impl::serialize<Interface>(parsed.error()));
             }
 
-            auto resolve = [resolve = std::move(exec.resolve)]<typename... Ts>(Ts &&...value)
+            auto invoke = [&](auto executor)
             {
-                std::invoke(resolve, impl::serialize<Interface>(std::forward<Ts>(value)...));
+                auto params = std::tuple_cat(std::move(parsed.value()), std::make_tuple(std::move(executor)));
+                std::apply(func, std::move(params));
             };
 
-            auto reject = [reject = std::move(exec.reject)]<typename... Ts>(Ts &&...value)
+            if constexpr (traits::is_stream_v<typename resolver::executor>)
             {
-                std::invoke(reject, impl::serialize<Interface>(std::forward<Ts>(value)...));
-            };
+                auto channel = std::invoke(exec.open);
+
+                auto yield = [yield = std::move(channel.yield)]<typename... Ts>(Ts &&...value)
+                {
+                    return std::invoke(yield, impl::serialize<Interface>(std::forward<Ts>(value)...));
+                };
 
-            auto executor = typename resolver::executor{std::move(resolve), std::move(reject)};
-            auto params   = std::tuple_cat(std::move(parsed.value()), std::make_tuple(std::move(executor)));
+                auto reject = [reject = std::move(channel.reject)]<typename... Ts>(Ts &&...value)
+                {
+                    std::invoke(reject, impl::serialize<Interface>(std::forward<Ts>(value)...));
+                };
 
-            std::apply(func, std::move(params));
+                invoke(typename resolver::executor{std::move(yield), std::move(channel.finish), std::move(reject)});
+            }
+            else
+            {
+                auto resolve = [resolve = std::move(exec.resolve), blobs = message.blobs]<typename... Ts>(Ts &&...value)
+                {
+                    std::invoke(resolve, impl::serialize_result<Interface>(blobs.get(), std::forward<Ts>(value)...));
+                };
+
+                auto reject = [reject = std::move(exec.reject)]<typename... Ts>(Ts &&...value)
+                {
+                    std::invoke(reject, impl::serialize<Interface>(std::forward<Ts>(value)...));
+                };
+
+                invoke(typename resolver::executor{std::move(resolve), std::move(reject)});
+            }
         };
     }
 
@@ -105,13 +229,22 @@ namespace saucer::serializers::generic
     template <typename T>
     auto serializer<FunctionData, ResultData, Interface>::resolve(std::promise<T> promise)
     {
-        return [promise = std::move(promise)](std::unique_ptr<saucer::result_data> data) mutable
+        return [promise = std::move(promise)](serializer::result data) mutable
         {
-            const auto &res = *static_cast<ResultData *>(data.get());
+            if (!data)
+            {
+                auto exception = std::runtime_error{data.error()};
+                auto ptr       = std::make_exception_ptr(exception);
+
+                promise.set_exception(ptr);
+                return;
+            }
+
+            const auto &res = *static_cast<ResultData *>(data.value().get());
 
             if constexpr (!std::is_void_v<T>)
             {
-                auto parsed = impl::parse<Interface, T>(res);
+                auto parsed = impl::parse_result<Interface, T>(res);
 
                 if (!parsed)
                 {
@@ -122,7 +255,7 @@ namespace saucer::serializers::generic
                     return;
                 }
 
-                promise.set_value(parsed.value());
+                promise.set_value(std::move(parsed.value()));
             }
             else
             {
@@ -8,12 +8,14 @@ namespace saucer::serializers::glaze
 {
     struct function_data : saucer::function_data
     {
-        glz::raw_json params;
+        message buffer;
+        glz::raw_json_view params;
     };
 
     struct result_data : saucer::result_data
     {
-        glz::raw_json result;
+        message buffer;
+        glz::raw_json_view result;
     };
 
     class interface
@@ -23,7 +25,7 @@ namespace saucer::serializers::glaze
 
       public:
         template <typename T>
-        static result<T> parse(const std::string &);
+        static result<T> parse(std::string_view);
 
       public:
         template <typename T>
@@ -46,7 +48,8 @@ namespace saucer::serializers::glaze
         [[nodiscard]] std::string js_serializer() const override;
 
       public:
-        [[nodiscard]] parse_result parse(const std::string &) const override;
+        [[nodiscard]] std::unique_ptr<saucer::function_data> parse_call(const message &) const override;
+        [[nodiscard]] std::unique_ptr<saucer::result_data> parse_resolve(const message &) const override;
     };
 } // namespace saucer::serializers::glaze
 
@@ -9,7 +9,7 @@ namespace saucer::serializers::glaze
 {
     namespace impl
     {
-        static constexpr auto opts = glz::opts{.error_on_missing_keys = true};
+        static constexpr auto opts = glz::opts{.null_terminated = false, .error_on_missing_keys = true};
 
         template <typename T>
         concept Readable = glz::read_supported<opts.format, T>;
@@ -57,7 +57,7 @@ namespace saucer::serializers::glaze
     } // namespace impl
 
     template <typename T>
-    interface::result<T> interface::parse(const std::string &data)
+    interface::result<T> interface::parse(std::string_view data)
     {
         static_assert(impl::Readable<T>, "T should be serializable");
 
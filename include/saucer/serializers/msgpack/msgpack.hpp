@@ -0,0 +1,66 @@
+#pragma once
+
+#include "../generic/generic.hpp"
+
+#include <span>
+#include <optional>
+#include <string_view>
+
+#include <rfl/msgpack.hpp>
+
+namespace saucer::serializers::msgpack
+{
+    struct function_data : saucer::function_data
+    {
+        std::string buffer;
+        std::string_view params;
+    };
+
+    struct result_data : saucer::result_data
+    {
+        std::string buffer;
+        std::string_view result;
+    };
+
+    namespace impl
+    {
+        std::string encode(std::span<const char>);
+        std::optional<std::string> decode(std::string_view);
+    } // namespace impl
+
+    class interface
+    {
+        template <typename T>
+        using result = std::expected<T, std::string>;
+
+      public:
+        template <typename T>
+        static result<T> parse(std::string_view);
+
+      public:
+        template <typename T>
+        static result<T> parse(const result_data &);
+
+        template <typename T>
+        static result<T> parse(const function_data &);
+
+      public:
+        template <typename T>
+        static std::string serialize(T &&);
+    };
+
+    struct serializer : generic::serializer<function_data, result_data, interface>
+    {
+        ~serializer() override;
+
+      public:
+        [[nodiscard]] std::string script() const override;
+        [[nodiscard]] std::string js_serializer() const override;
+
+      public:
+        [[nodiscard]] std::unique_ptr<saucer::function_data> parse_call(const message &) const override;
+        [[nodiscard]] std::unique_ptr<saucer::result_data> parse_resolve(const message &) const override;
+    };
+} // namespace saucer::serializers::msgpack
+
+#include "msgpack.inl"
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "msgpack.hpp"
+
+#include <fmt/core.h>
+
+namespace saucer::serializers::msgpack
+{
+    namespace impl
+    {
+        template <typename T>
+        struct is_fixed_string : std::false_type
+        {
+        };
+
+        template <std::size_t N>
+        struct is_fixed_string<const char (&)[N]> : std::true_type
+        {
+        };
+
+        template <typename T>
+        concept fixed_string = is_fixed_string<T>::value;
+
+        template <typename T>
+        concept Readable = requires(const char *data, std::size_t size) {
+            { rfl::msgpack::read<std::remove_cvref_t<T>>(data, size) };
+        };
+
+        template <typename T>
+        concept Writable = requires(T value) {
+            { rfl::msgpack::write(value) };
+        };
+
+        template <typename T>
+        auto write(T &&value)
+        {
+            if constexpr (fixed_string<T>)
+            {
+                return rfl::msgpack::write(std::string{std::forward<T>(value)});
+            }
+            else
+            {
+                return rfl::msgpack::write(std::forward<T>(value));
+            }
+        }
+    } // namespace impl
+
+    template <typename T>
+    interface::result<T> interface::parse(std::string_view data)
+    {
+        static_assert(impl::Readable<T>, "T should be serializable");
+
+        auto rtn = rfl::msgpack::read<T>(data.data(), data.size());
+
+        if (rtn)
+        {
+            return rtn.value();
+        }
+
+        return std::unexpected{rtn.error().what()};
+    }
+
+    template <typename T>
+    interface::result<T> interface::parse(const result_data &data)
+    {
+        return parse<T>(data.result);
+    }
+
+    template <typename T>
+    interface::result<T> interface::parse(const function_data &data)
+    {
+        return parse<T>(data.params);
+    }
+
+    template <typename T>
+    std::string interface::serialize(T &&value)
+    {
+        static_assert(impl::Writable<T>, "T should be serializable");
+
+        const auto bytes = impl::write(std::forward<T>(value));
+        return fmt::format(R"(window.saucer.internal.msgpack.decode("{}"))", impl::encode(bytes));
+    }
+} // namespace saucer::serializers::msgpack
@@ -2,18 +2,22 @@
 
 #include "../generic/generic.hpp"
 
+#include <memory>
+
 #include <rfl/json.hpp>
 
 namespace saucer::serializers::rflpp
 {
     struct function_data : saucer::function_data
     {
-        rfl::Generic params;
+        std::shared_ptr<yyjson_doc> document;
+        yyjson_val *params;
     };
 
     struct result_data : saucer::result_data
     {
-        rfl::Generic result;
+        std::shared_ptr<yyjson_doc> document;
+        yyjson_val *result;
     };
 
     class interface
@@ -46,7 +50,8 @@ namespace saucer::serializers::rflpp
         [[nodiscard]] std::string js_serializer() const override;
 
       public:
-        [[nodiscard]] parse_result parse(const std::string &) const override;
+        [[nodiscard]] std::unique_ptr<saucer::function_data> parse_call(const message &) const override;
+        [[nodiscard]] std::unique_ptr<saucer::result_data> parse_resolve(const message &) const override;
     };
 } // namespace saucer::serializers::rflpp
 
@@ -30,15 +30,15 @@ namespace saucer::serializers::rflpp
         };
 
         template <typename T>
-        auto parse(const std::string &data)
+        auto parse(std::string_view data)
         {
             return rfl::json::read<T>(data);
         }
 
         template <typename T>
-        auto parse(const rfl::Generic &data)
+        auto parse(yyjson_val *data)
         {
-            return rfl::from_generic<T>(data);
+            return rfl::json::read<T>(rfl::json::InputVarType{data});
         }
     } // namespace impl
 
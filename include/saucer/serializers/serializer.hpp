@@ -3,6 +3,7 @@
 #include "data.hpp"
 
 #include "args/args.hpp"
+#include "../message.hpp"
 #include "../executor.hpp"
 
 #include <concepts>
@@ -11,6 +12,7 @@
 #include <string>
 #include <memory>
 #include <future>
+#include <expected>
 
 #include <fmt/args.h>
 
@@ -18,12 +20,18 @@ namespace saucer
 {
     struct serializer
     {
-        using parse_result = message_data;
-        using executor     = saucer::executor<std::string>;
-        using args         = fmt::dynamic_format_arg_store<fmt::format_context>;
+        using channel = saucer::stream<std::string>;
+        using args    = fmt::dynamic_format_arg_store<fmt::format_context>;
 
       public:
-        using resolver = std::move_only_function<void(std::unique_ptr<result_data>)>;
+        struct executor : saucer::executor<std::string>
+        {
+            std::function<channel()> open;
+        };
+
+      public:
+        using result   = std::expected<std::unique_ptr<result_data>, std::string>;
+        using resolver = std::move_only_function<void(result)>;
         using function = std::move_only_function<void(std::unique_ptr<function_data>, executor)>;
 
       public:
@@ -34,7 +42,8 @@ namespace saucer
         [[nodiscard]] virtual std::string js_serializer() const = 0;
 
       public:
-        [[nodiscard]] virtual parse_result parse(const std::string &) const = 0;
+        [[nodiscard]] virtual std::unique_ptr<function_data> parse_call(const message &) const  = 0;
+        [[nodiscard]] virtual std::unique_ptr<result_data> parse_resolve(const message &) const = 0;
     };
 
     template <class T>
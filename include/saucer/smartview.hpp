@@ -1,18 +1,43 @@
 #pragma once
 
+#include "task.hpp"
 #include "webview.hpp"
 #include "config.hpp"
+#include "throttle.hpp"
 
+#include "utils/future.hpp"
+
+#include <chrono>
 #include <future>
-#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stop_token>
 
 #include <string>
 #include <memory>
+#include <utility>
 
 #include <string_view>
 
 namespace saucer
 {
+    struct evaluate_options
+    {
+        std::optional<std::chrono::milliseconds> timeout;
+        std::stop_token token;
+    };
+
+    struct prepared_script
+    {
+        // The call expression is built once, the script is removed from the page when the last copy is released.
+        std::shared_ptr<const std::string> invocation;
+    };
+
+    template <typename... Params>
+    struct prepared : prepared_script
+    {
+    };
+
     class smartview_core : public webview
     {
         struct impl;
@@ -20,8 +45,9 @@ namespace saucer
       private:
         std::unique_ptr<impl> m_impl;
 
-      protected:
-        std::atomic_uint64_t m_id_counter{0};
+      public:
+        static constexpr std::size_t stream_window  = 16;
+        static constexpr std::size_t stream_backlog = 1024;
 
       protected:
         smartview_core(std::unique_ptr<serializer>, const preferences &);
@@ -30,15 +56,24 @@ namespace saucer
         ~smartview_core() override;
 
       protected:
-        bool on_message(const std::string &) override;
+        void on_unload() override;
 
       protected:
         void call(std::unique_ptr<function_data>);
         void resolve(std::unique_ptr<result_data>);
 
       protected:
-        void add_function(std::string, serializer::function &&, launch);
-        void add_evaluation(serializer::resolver &&, const std::string &);
+        void add_function(std::string, serializer::function &&, launch, std::shared_ptr<throttle> = nullptr);
+        void add_evaluation(serializer::resolver &&, const std::string &, const evaluate_options & = {});
+
+      protected:
+        void grant(std::uint64_t, std::int64_t);
+
+      protected:
+        prepared_script add_prepared(std::string_view, std::size_t);
+
+      public:
+        [[sc::thread_safe]] [[nodiscard]] std::optional<throttle_stats> stats(const std::string &name) const;
 
       public:
         [[sc::thread_safe]] void clear_exposed();
@@ -50,17 +85,59 @@ namespace saucer
     {
         smartview(const preferences &);
 
+      private:
+        template <typename Return>
+        static std::pair<serializer::resolver, future<Return>> pending();
+
       public:
         template <typename Function>
         [[sc::thread_safe]] void expose(std::string name, Function &&func, launch policy = launch::sync);
 
+        template <typename Function>
+        [[sc::thread_safe]] void expose(std::string name, Function &&func, const throttle_options &limits);
+
+        template <typename Function>
+        [[sc::thread_safe]] void expose(std::string name, Function &&func, std::shared_ptr<throttle> group);
+
       public:
         template <typename... Params>
         [[sc::thread_safe]] void execute(std::string_view code, Params &&...params);
 
       public:
+        template <typename T>
+        [[sc::thread_safe]] bool emit(const std::string &channel, T &&value, coalesce policy = coalesce::none);
+
+      public:
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] future<Return> evaluate(std::string_view code, Params &&...params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] future<Return> evaluate(const evaluate_options &options, std::string_view code,
+                                                                  Params &&...params);
+
+      public:
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] task<Return> evaluate_async(std::string_view code, Params &&...params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] task<Return> evaluate_async(evaluate_options options, std::string_view code,
+                                                                     Params &&...params);
+
+      public:
+        template <typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] prepared<Params...> prepare(std::string_view code);
+
+        template <typename... Params>
+        [[sc::thread_safe]] void execute(const prepared<Params...> &script, std::type_identity_t<Params>... params);
+
+        template <typename Return, typename... Params>
+        [[sc::thread_safe]] [[nodiscard]] future<Return> evaluate(const prepared<Params...> &script,
+                                                                  std::type_identity_t<Params>... params);
+
         template <typename Return, typename... Params>
-        [[sc::thread_safe]] [[nodiscard]] std::future<Return> evaluate(std::string_view code, Params &&...params);
+        [[sc::thread_safe]] [[nodiscard]] future<Return> evaluate(const evaluate_options &options,
+                                                                  const prepared<Params...> &script,
+                                                                  std::type_identity_t<Params>... params);
     };
 } // namespace saucer
 
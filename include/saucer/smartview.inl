@@ -9,6 +9,24 @@ namespace saucer
     {
     }
 
+    template <Serializer Serializer>
+    template <typename Return>
+    std::pair<serializer::resolver, future<Return>> smartview<Serializer>::pending()
+    {
+        std::promise<Return> promise;
+
+        auto signal = std::make_shared<saucer::impl::signal>();
+        auto rtn    = future<Return>{promise.get_future(), signal};
+
+        auto resolve = [resolve = Serializer::resolve(std::move(promise)),
+                        notify  = saucer::impl::notifier{signal}](serializer::result result) mutable
+        {
+            std::invoke(resolve, std::move(result));
+        };
+
+        return {std::move(resolve), std::move(rtn)};
+    }
+
     template <Serializer Serializer>
     template <typename... Params>
     void smartview<Serializer>::execute(std::string_view code, Params &&...params)
@@ -17,19 +35,133 @@ namespace saucer
         webview::execute(fmt::vformat(code, args));
     }
 
+    template <Serializer Serializer>
+    template <typename T>
+    bool smartview<Serializer>::emit(const std::string &channel, T &&value, coalesce policy)
+    {
+        auto args = Serializer::serialize_args(std::forward<T>(value));
+        return webview::emit(channel, fmt::vformat("{}", args), policy);
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    future<Return> smartview<Serializer>::evaluate(std::string_view code, Params &&...params)
+    {
+        return evaluate<Return>(evaluate_options{}, code, std::forward<Params>(params)...);
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    future<Return> smartview<Serializer>::evaluate(const evaluate_options &options, std::string_view code,
+                                                   Params &&...params)
+    {
+        auto [resolve, rtn] = pending<Return>();
+        auto args           = Serializer::serialize_args(std::forward<Params>(params)...);
+
+        add_evaluation(std::move(resolve), fmt::vformat(code, args), options);
+
+        return std::move(rtn);
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    task<Return> smartview<Serializer>::evaluate_async(std::string_view code, Params &&...params)
+    {
+        return evaluate_async<Return>(evaluate_options{}, code, std::forward<Params>(params)...);
+    }
+
     template <Serializer Serializer>
     template <typename Return, typename... Params>
-    std::future<Return> smartview<Serializer>::evaluate(std::string_view code, Params &&...params)
+    task<Return> smartview<Serializer>::evaluate_async(evaluate_options options, std::string_view code,
+                                                       Params &&...params)
     {
         std::promise<Return> promise;
         auto rtn = promise.get_future();
 
         auto args    = Serializer::serialize_args(std::forward<Params>(params)...);
         auto resolve = Serializer::resolve(std::move(promise));
+        auto script  = fmt::vformat(code, args);
+
+        struct settle
+        {
+            serializer::resolver resolve;
+            std::move_only_function<void()> resume;
+
+          public:
+            void operator()(serializer::result result)
+            {
+                std::invoke(std::exchange(resolve, nullptr), std::move(result));
+                std::invoke(std::exchange(resume, nullptr));
+            }
+
+          public:
+            ~settle()
+            {
+                if (!resume)
+                {
+                    return;
+                }
+
+                // The evaluation was dropped without being settled (i.e. the smartview was destroyed), breaking the promise
+                // first makes the resumed coroutine observe a `broken_promise` error instead of waiting forever.
+
+                resolve = nullptr;
+                std::invoke(resume);
+            }
+        };
+
+        auto submit = [&](std::move_only_function<void()> resume)
+        {
+            auto state    = std::make_unique<settle>(std::move(resolve), std::move(resume));
+            auto callback = [state = std::move(state)](serializer::result result) mutable
+            {
+                std::invoke(*state, std::move(result));
+            };
+
+            add_evaluation(std::move(callback), script, options);
+        };
 
-        add_evaluation(std::move(resolve), fmt::vformat(code, args));
+        co_await saucer::impl::continuation<decltype(submit)>{std::move(submit)};
 
-        return rtn;
+        co_return rtn.get();
+    }
+
+    template <Serializer Serializer>
+    template <typename... Params>
+    prepared<Params...> smartview<Serializer>::prepare(std::string_view code)
+    {
+        return {add_prepared(code, sizeof...(Params))};
+    }
+
+    template <Serializer Serializer>
+    template <typename... Params>
+    void smartview<Serializer>::execute(const prepared<Params...> &script, std::type_identity_t<Params>... params)
+    {
+        auto args = Serializer::serialize_args(std::move(params)...);
+        webview::execute(fmt::format("{};", fmt::vformat(*script.invocation, args)));
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    future<Return> smartview<Serializer>::evaluate(const prepared<Params...> &script,
+                                                   std::type_identity_t<Params>... params)
+    {
+        return evaluate<Return>(evaluate_options{}, script, std::move(params)...);
+    }
+
+    template <Serializer Serializer>
+    template <typename Return, typename... Params>
+    future<Return> smartview<Serializer>::evaluate(const evaluate_options &options, const prepared<Params...> &script,
+                                                   std::type_identity_t<Params>... params)
+    {
+        auto [resolve, rtn] = pending<Return>();
+
+        auto args = Serializer::serialize_args(std::move(params)...);
+        auto code = fmt::format("await {}", fmt::vformat(*script.invocation, args));
+
+        add_evaluation(std::move(resolve), code, options);
+
+        return std::move(rtn);
     }
 
     template <Serializer Serializer>
@@ -39,4 +171,20 @@ namespace saucer
         auto resolve = Serializer::serialize(std::forward<Function>(func));
         add_function(std::move(name), std::move(resolve), policy);
     }
+
+    template <Serializer Serializer>
+    template <typename Function>
+    void smartview<Serializer>::expose(std::string name, Function &&func, const throttle_options &limits)
+    {
+        auto resolve = Serializer::serialize(std::forward<Function>(func));
+        add_function(std::move(name), std::move(resolve), launch::async, std::make_shared<throttle>(m_parent.get(), limits));
+    }
+
+    template <Serializer Serializer>
+    template <typename Function>
+    void smartview<Serializer>::expose(std::string name, Function &&func, std::shared_ptr<throttle> group)
+    {
+        auto resolve = Serializer::serialize(std::forward<Function>(func));
+        add_function(std::move(name), std::move(resolve), launch::async, std::move(group));
+    }
 } // namespace saucer
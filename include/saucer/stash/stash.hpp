@@ -40,6 +40,9 @@ namespace saucer
         template <typename Callback>
         [[nodiscard]] static stash lazy(Callback);
 
+      public:
+        [[nodiscard]] static stash shared(std::shared_ptr<stash> data);
+
       public:
         [[nodiscard]] static stash empty();
     };
@@ -64,6 +64,17 @@ namespace saucer
         return {std::async(std::launch::deferred, std::move(fn)).share()};
     }
 
+    template <typename T>
+    stash<T> stash<T>::shared(std::shared_ptr<stash> data)
+    {
+        // The data is already available, it is merely wrapped into a ready future so that copies share it.
+
+        std::promise<std::shared_ptr<stash>> promise;
+        promise.set_value(std::move(data));
+
+        return {promise.get_future().share()};
+    }
+
     template <typename T>
     stash<T> stash<T>::empty()
     {
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <mutex>
+#include <utility>
+#include <optional>
+#include <expected>
+#include <exception>
+#include <coroutine>
+#include <functional>
+
+namespace saucer
+{
+    template <typename T = void>
+    class task;
+
+    namespace impl
+    {
+        template <typename T>
+        struct task_value
+        {
+            std::optional<T> value;
+
+          public:
+            void return_value(T result)
+            {
+                value.emplace(std::move(result));
+            }
+
+            T take()
+            {
+                return std::move(value.value());
+            }
+        };
+
+        template <>
+        struct task_value<void>
+        {
+            void return_void() {}
+            void take() {}
+        };
+
+        template <typename T>
+        struct task_promise : task_value<T>
+        {
+            using handle = std::coroutine_handle<task_promise>;
+
+          public:
+            std::mutex mutex;
+            std::exception_ptr exception;
+
+          public:
+            bool finished{false};
+            bool detached{false};
+
+          public:
+            std::coroutine_handle<> awaiting;
+            std::move_only_function<void()> continuation;
+
+          public:
+            task<T> get_return_object();
+
+          public:
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            auto final_suspend() noexcept
+            {
+                struct awaiter
+                {
+                    bool await_ready() noexcept
+                    {
+                        return false;
+                    }
+
+                    std::coroutine_handle<> await_suspend(handle coroutine) noexcept
+                    {
+                        auto &promise = coroutine.promise();
+
+                        std::coroutine_handle<> awaiting;
+                        std::move_only_function<void()> continuation;
+
+                        bool detached{};
+
+                        {
+                            const std::lock_guard guard{promise.mutex};
+
+                            promise.finished = true;
+                            detached         = promise.detached;
+                            awaiting         = std::exchange(promise.awaiting, nullptr);
+                            continuation     = std::move(promise.continuation);
+                        }
+
+                        if (continuation)
+                        {
+                            std::invoke(continuation);
+                        }
+
+                        if (detached)
+                        {
+                            coroutine.destroy();
+                        }
+
+                        // An awaiting coroutine is resumed through symmetric transfer instead of from within this frame,
+                        // so that long chains of tasks do not grow the stack.
+
+                        return awaiting ? awaiting : std::noop_coroutine();
+                    }
+
+                    void await_resume() noexcept {}
+                };
+
+                return awaiter{};
+            }
+
+          public:
+            void unhandled_exception()
+            {
+                exception = std::current_exception();
+            }
+
+          public:
+            bool attach(std::move_only_function<void()> &callback, bool detach = false)
+            {
+                const std::lock_guard guard{mutex};
+
+                if (finished)
+                {
+                    return false;
+                }
+
+                continuation = std::move(callback);
+                detached     = detach;
+
+                return true;
+            }
+
+            bool attach(std::coroutine_handle<> coroutine)
+            {
+                const std::lock_guard guard{mutex};
+
+                if (finished)
+                {
+                    return false;
+                }
+
+                awaiting = coroutine;
+
+                return true;
+            }
+
+            auto result()
+            {
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+
+                return this->take();
+            }
+        };
+
+        template <typename Callback>
+        struct continuation
+        {
+            Callback callback;
+
+          public:
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::coroutine_handle<> coroutine)
+            {
+                auto callback = std::move(this->callback);
+                std::invoke(callback, [coroutine] { coroutine.resume(); });
+            }
+
+            void await_resume() noexcept {}
+        };
+    } // namespace impl
+
+    template <typename T>
+    class task
+    {
+        friend struct impl::task_promise<T>;
+
+      public:
+        using promise_type = impl::task_promise<T>;
+        using result_type  = std::expected<T, std::exception_ptr>;
+
+      private:
+        promise_type::handle m_handle;
+
+      private:
+        task(promise_type::handle);
+
+      public:
+        task(task &&) noexcept;
+        task &operator=(task &&) noexcept = delete;
+
+      public:
+        ~task();
+
+      public:
+        [[nodiscard]] bool ready() const;
+
+      public:
+        void then(std::move_only_function<void(result_type)> callback) &&;
+
+      public:
+        bool await_ready() const;
+        bool await_suspend(std::coroutine_handle<>);
+        T await_resume();
+    };
+} // namespace saucer
+
+#include "task.inl"
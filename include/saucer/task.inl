@@ -0,0 +1,108 @@
+#pragma once
+
+#include "task.hpp"
+
+namespace saucer
+{
+    template <typename T>
+    task<T> impl::task_promise<T>::get_return_object()
+    {
+        return {handle::from_promise(*this)};
+    }
+
+    template <typename T>
+    task<T>::task(promise_type::handle handle) : m_handle(handle)
+    {
+    }
+
+    template <typename T>
+    task<T>::task(task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    template <typename T>
+    task<T>::~task()
+    {
+        if (!m_handle)
+        {
+            return;
+        }
+
+        auto &promise = m_handle.promise();
+
+        {
+            const std::lock_guard guard{promise.mutex};
+
+            if (!promise.finished)
+            {
+                promise.detached = true;
+                return;
+            }
+        }
+
+        m_handle.destroy();
+    }
+
+    template <typename T>
+    bool task<T>::ready() const
+    {
+        auto &promise = m_handle.promise();
+        const std::lock_guard guard{promise.mutex};
+
+        return promise.finished;
+    }
+
+    template <typename T>
+    void task<T>::then(std::move_only_function<void(result_type)> callback) &&
+    {
+        // The continuation takes over the frame: once attached, the coroutine destroys itself after running it, so this
+        // task must not touch the handle again.
+
+        auto handle = std::exchange(m_handle, nullptr);
+
+        std::move_only_function<void()> continuation = [handle, callback = std::move(callback)]() mutable
+        {
+            auto &promise = handle.promise();
+
+            if (promise.exception)
+            {
+                return std::invoke(callback, std::unexpected{promise.exception});
+            }
+
+            if constexpr (std::is_void_v<T>)
+            {
+                std::invoke(callback, result_type{});
+            }
+            else
+            {
+                std::invoke(callback, promise.take());
+            }
+        };
+
+        if (handle.promise().attach(continuation, true))
+        {
+            return;
+        }
+
+        std::invoke(continuation);
+        handle.destroy();
+    }
+
+    template <typename T>
+    bool task<T>::await_ready() const
+    {
+        return ready();
+    }
+
+    template <typename T>
+    bool task<T>::await_suspend(std::coroutine_handle<> coroutine)
+    {
+        return m_handle.promise().attach(coroutine);
+    }
+
+    template <typename T>
+    T task<T>::await_resume()
+    {
+        return m_handle.promise().result();
+    }
+} // namespace saucer
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+#include <functional>
+
+namespace saucer
+{
+    struct application;
+
+    enum class overflow : std::uint8_t
+    {
+        reject,
+        drop_oldest,
+        block,
+    };
+
+    struct throttle_options
+    {
+        std::size_t max_in_flight{1};
+        std::size_t queue_depth{64};
+        saucer::overflow overflow{saucer::overflow::reject};
+    };
+
+    struct throttle_stats
+    {
+        std::size_t in_flight;
+        std::size_t queued;
+        std::size_t waiting;
+        std::size_t peak_queued;
+
+      public:
+        std::uint64_t completed;
+        std::uint64_t rejected;
+        std::uint64_t dropped;
+    };
+
+    class throttle
+    {
+        struct impl;
+
+      public:
+        using done     = std::function<void()>;
+        using task     = std::move_only_function<void(done)>;
+        using rejector = std::move_only_function<void()>;
+
+      private:
+        std::shared_ptr<impl> m_impl;
+
+      public:
+        throttle(application *, throttle_options);
+
+      public:
+        ~throttle();
+
+      public:
+        [[sc::thread_safe]] void submit(task, rejector);
+        [[sc::thread_safe]] [[nodiscard]] throttle_stats stats() const;
+
+      public:
+        [[nodiscard]] static std::shared_ptr<throttle> strand(application *);
+    };
+} // namespace saucer
@@ -1,17 +1,93 @@
 #pragma once
 
 #include <future>
+#include <memory>
+
+#include <tuple>
+#include <variant>
+
+#include <mutex>
+
+#include <functional>
 
 namespace saucer
 {
+    namespace impl
+    {
+        struct signal
+        {
+            std::mutex mutex;
+            bool fired{false};
+            std::move_only_function<void()> callback;
+
+          public:
+            void fire();
+            bool attach(std::move_only_function<void()> &);
+        };
+
+        struct notifier
+        {
+            std::shared_ptr<signal> target;
+
+          public:
+            notifier(std::shared_ptr<signal>);
+
+          public:
+            notifier(notifier &&) noexcept = default;
+
+          public:
+            ~notifier();
+        };
+
+        template <typename T>
+        T future_value(const std::future<T> &);
+
+        template <typename F>
+        using future_value_t = decltype(future_value(std::declval<F>()));
+
+        template <typename T>
+        using value_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        void watch(std::move_only_function<bool()>);
+        void schedule(std::move_only_function<void()>);
+    } // namespace impl
+
+    template <typename T>
+    class future : public std::future<T>
+    {
+        template <typename U, typename Callback>
+        friend void ready(future<U>, Callback);
+
+      private:
+        std::shared_ptr<impl::signal> m_signal;
+
+      public:
+        future(std::future<T>, std::shared_ptr<impl::signal>);
+    };
+
+    template <typename T, typename Callback>
+    void ready(std::future<T>, Callback);
+
+    template <typename T, typename Callback>
+    void ready(future<T>, Callback);
+
     template <typename... T>
     auto all(std::future<T> &...);
 
     template <typename... T>
     auto all(std::future<T>...);
 
-    template <typename T, typename Callback, typename>
-    void then(std::future<T>, Callback &&);
+    template <typename... Futures>
+    auto when_all(Futures...);
+
+    template <typename... Futures>
+    auto when_any(Futures...);
+
+    template <typename T, typename Callback>
+    void then(std::future<T>, Callback);
+
+    template <typename T, typename Callback>
+    void then(future<T>, Callback);
 
     template <typename Callback>
     class then_pipe;
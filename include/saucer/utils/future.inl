@@ -2,10 +2,136 @@
 
 #include "future.hpp"
 
-#include <functional>
+#include <atomic>
+#include <chrono>
+#include <utility>
 
 namespace saucer
 {
+    namespace impl
+    {
+        inline void signal::fire()
+        {
+            std::move_only_function<void()> pending;
+
+            {
+                const std::lock_guard guard{mutex};
+
+                if (std::exchange(fired, true))
+                {
+                    return;
+                }
+
+                pending = std::move(callback);
+            }
+
+            if (!pending)
+            {
+                return;
+            }
+
+            std::invoke(pending);
+        }
+
+        inline bool signal::attach(std::move_only_function<void()> &pending)
+        {
+            const std::lock_guard guard{mutex};
+
+            if (fired)
+            {
+                return false;
+            }
+
+            callback = std::move(pending);
+            return true;
+        }
+
+        inline notifier::notifier(std::shared_ptr<signal> target) : target(std::move(target)) {}
+
+        inline notifier::~notifier()
+        {
+            if (!target)
+            {
+                return;
+            }
+
+            target->fire();
+        }
+
+        template <typename T>
+        value_t<T> take(std::future<T> &future)
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                future.get();
+                return {};
+            }
+            else
+            {
+                return future.get();
+            }
+        }
+
+        template <typename T, typename Callback>
+        void settle(std::future<T> &future, Callback &callback)
+        {
+            if constexpr (std::is_void_v<T>)
+            {
+                future.get();
+                std::invoke(callback);
+            }
+            else
+            {
+                std::invoke(callback, future.get());
+            }
+        }
+    } // namespace impl
+
+    template <typename T>
+    future<T>::future(std::future<T> future, std::shared_ptr<impl::signal> signal)
+        : std::future<T>(std::move(future)), m_signal(std::move(signal))
+    {
+    }
+
+    template <typename T, typename Callback>
+    void ready(std::future<T> future, Callback callback)
+    {
+        auto poll = [future = std::move(future), callback = std::move(callback)]() mutable
+        {
+            if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            {
+                return false;
+            }
+
+            impl::schedule([future = std::move(future), callback = std::move(callback)]() mutable
+                           { std::invoke(callback, std::move(future)); });
+
+            return true;
+        };
+
+        impl::watch(std::move(poll));
+    }
+
+    template <typename T, typename Callback>
+    void ready(future<T> future, Callback callback)
+    {
+        auto signal = future.m_signal;
+
+        std::move_only_function<void()> continuation =
+            [future = static_cast<std::future<T> &&>(future), callback = std::move(callback)]() mutable
+        {
+            impl::schedule([future = std::move(future), callback = std::move(callback)]() mutable
+                           { std::invoke(callback, std::move(future)); });
+        };
+
+        if (signal->attach(continuation))
+        {
+            return;
+        }
+
+        std::invoke(continuation);
+    }
+
     template <typename... T>
     auto all(std::future<T> &...futures)
     {
@@ -31,14 +157,129 @@ namespace saucer
         return std::tuple_cat(make_tuple(std::move(futures))...);
     }
 
+    template <typename... Futures>
+    auto when_all(Futures... futures)
+    {
+        using result = std::tuple<impl::value_t<impl::future_value_t<Futures>>...>;
+
+        struct state
+        {
+            std::mutex mutex;
+            std::size_t remaining{sizeof...(Futures)};
+            std::tuple<std::future<impl::future_value_t<Futures>>...> ready;
+
+          public:
+            std::promise<result> promise;
+            std::shared_ptr<impl::signal> signal = std::make_shared<impl::signal>();
+        };
+
+        auto shared = std::make_shared<state>();
+        auto rtn    = future<result>{shared->promise.get_future(), shared->signal};
+
+        auto finish = [shared]<auto... Is>(std::index_sequence<Is...>)
+        {
+            const impl::notifier notify{shared->signal};
+
+            try
+            {
+                shared->promise.set_value(result{impl::take(std::get<Is>(shared->ready))...});
+            }
+            catch (...)
+            {
+                shared->promise.set_exception(std::current_exception());
+            }
+        };
+
+        auto watch = [&]<auto I>(std::integral_constant<std::size_t, I>, auto future)
+        {
+            ready(std::move(future),
+                  [shared, finish](auto value) mutable
+                  {
+                      {
+                          const std::lock_guard guard{shared->mutex};
+                          std::get<I>(shared->ready) = std::move(value);
+
+                          if (--shared->remaining > 0)
+                          {
+                              return;
+                          }
+                      }
+
+                      finish(std::index_sequence_for<Futures...>());
+                  });
+        };
+
+        [&]<auto... Is>(std::index_sequence<Is...>)
+        {
+            (watch(std::integral_constant<std::size_t, Is>(), std::move(futures)), ...);
+        }(std::index_sequence_for<Futures...>());
+
+        if constexpr (sizeof...(Futures) == 0)
+        {
+            finish(std::index_sequence<>());
+        }
+
+        return rtn;
+    }
+
+    template <typename... Futures>
+    auto when_any(Futures... futures)
+    {
+        using result = std::variant<impl::value_t<impl::future_value_t<Futures>>...>;
+
+        struct state
+        {
+            std::atomic_bool settled{false};
+
+          public:
+            std::promise<result> promise;
+            std::shared_ptr<impl::signal> signal = std::make_shared<impl::signal>();
+        };
+
+        auto shared = std::make_shared<state>();
+        auto rtn    = future<result>{shared->promise.get_future(), shared->signal};
+
+        auto watch = [&]<auto I>(std::integral_constant<std::size_t, I>, auto future)
+        {
+            ready(std::move(future),
+                  [shared](auto value)
+                  {
+                      if (shared->settled.exchange(true))
+                      {
+                          return;
+                      }
+
+                      const impl::notifier notify{shared->signal};
+
+                      try
+                      {
+                          shared->promise.set_value(result{std::in_place_index<I>, impl::take(value)});
+                      }
+                      catch (...)
+                      {
+                          shared->promise.set_exception(std::current_exception());
+                      }
+                  });
+        };
+
+        [&]<auto... Is>(std::index_sequence<Is...>)
+        {
+            (watch(std::integral_constant<std::size_t, Is>(), std::move(futures)), ...);
+        }(std::index_sequence_for<Futures...>());
+
+        return rtn;
+    }
+
     template <typename T, typename Callback>
     void then(std::future<T> future, Callback callback)
     {
-        std::thread{[future = std::move(future), callback = std::move(callback)]() mutable
-                    {
-                        std::invoke(callback, future.get());
-                    }}
-            .detach();
+        ready(std::move(future), [callback = std::move(callback)](auto value) mutable { impl::settle(value, callback); });
+    }
+
+    template <typename T, typename Callback>
+    void then(future<T> future, Callback callback)
+    {
+        ready(std::move(future), [callback = std::move(callback)](auto value) mutable { impl::settle(value, callback); });
     }
 
     template <typename Callback>
@@ -55,6 +296,12 @@ namespace saucer
         {
             then(std::move(future), std::move(pipe.m_callback));
         }
+
+        template <typename T>
+        friend void operator|(future<T> &&future, then_pipe pipe)
+        {
+            then(std::move(future), std::move(pipe.m_callback));
+        }
     };
 
     template <typename Callback>
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <optional>
+#include <functional>
+
+#include <bit>
+#include <cstdint>
+
+namespace saucer
+{
+    template <typename T>
+    class slots
+    {
+        static constexpr std::uint32_t base = 64;
+        static constexpr std::size_t count  = 26;
+
+      private:
+        // Ids have to stay below 2^53 so that they survive a round trip through JavaScript.
+        static constexpr std::uint32_t generations = 1u << 21;
+
+      private:
+        struct slot
+        {
+            // Even generations are free, odd generations are occupied.
+            std::atomic_uint32_t generation{0};
+            std::atomic_uint32_t next{0};
+
+          public:
+            std::optional<T> value;
+        };
+
+      private:
+        std::atomic_uint64_t m_free{0};
+        std::atomic_uint32_t m_size{0};
+        std::array<std::atomic<slot *>, count> m_segments{};
+
+      public:
+        slots() = default;
+
+      public:
+        slots(const slots &) = delete;
+        slots &operator=(const slots &) = delete;
+
+      public:
+        ~slots()
+        {
+            for (auto i = 0uz; count > i; ++i)
+            {
+                delete[] m_segments[i].load();
+            }
+        }
+
+      private:
+        static constexpr auto locate(std::uint32_t index)
+        {
+            const auto segment = std::bit_width((index / base) + 1) - 1;
+            const auto offset  = index - (base * ((1u << segment) - 1));
+
+            return std::make_pair(static_cast<std::size_t>(segment), offset);
+        }
+
+        slot &at(std::uint32_t index)
+        {
+            const auto [segment, offset] = locate(index);
+            auto *data                   = m_segments[segment].load(std::memory_order_acquire);
+
+            if (!data)
+            {
+                auto *fresh = new slot[base << segment];
+
+                if (m_segments[segment].compare_exchange_strong(data, fresh, std::memory_order_acq_rel))
+                {
+                    data = fresh;
+                }
+                else
+                {
+                    delete[] fresh;
+                }
+            }
+
+            return data[offset];
+        }
+
+      private:
+        std::optional<std::uint32_t> pop()
+        {
+            auto head = m_free.load(std::memory_order_acquire);
+
+            while (static_cast<std::uint32_t>(head) != 0)
+            {
+                const auto index = static_cast<std::uint32_t>(head) - 1;
+                const auto next  = at(index).next.load(std::memory_order_relaxed);
+                const auto tag   = (head >> 32) + 1;
+
+                if (m_free.compare_exchange_weak(head, (tag << 32) | next, std::memory_order_acq_rel))
+                {
+                    return index;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        void push(std::uint32_t index)
+        {
+            auto &current = at(index);
+            auto head     = m_free.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                current.next.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+
+                const auto tag = (head >> 32) + 1;
+
+                if (m_free.compare_exchange_weak(head, (tag << 32) | (index + 1), std::memory_order_acq_rel))
+                {
+                    return;
+                }
+            }
+        }
+
+        static std::uint32_t advance(std::uint32_t generation)
+        {
+            return (generation + 1) % generations;
+        }
+
+        std::optional<T> release(std::uint32_t index, std::uint32_t generation)
+        {
+            auto &current = at(index);
+
+            if (!current.generation.compare_exchange_strong(generation, advance(generation), std::memory_order_acq_rel))
+            {
+                return std::nullopt;
+            }
+
+            auto rtn = std::move(current.value);
+            current.value.reset();
+
+            push(index);
+
+            return rtn;
+        }
+
+      public:
+        [[nodiscard]] std::uint64_t claim(T value)
+        {
+            auto index = pop();
+
+            if (!index)
+            {
+                index = m_size.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            auto &current = at(index.value());
+            current.value.emplace(std::move(value));
+
+            const auto generation = advance(current.generation.load(std::memory_order_relaxed));
+            current.generation.store(generation, std::memory_order_release);
+
+            return (static_cast<std::uint64_t>(generation) << 32) | index.value();
+        }
+
+        [[nodiscard]] std::optional<T> take(std::uint64_t id)
+        {
+            const auto index = static_cast<std::uint32_t>(id);
+            auto generation  = static_cast<std::uint32_t>(id >> 32);
+
+            if (index >= m_size.load(std::memory_order_acquire) || generation % 2 == 0)
+            {
+                return std::nullopt;
+            }
+
+            return release(index, generation);
+        }
+
+        template <typename Callback>
+        void drain(Callback &&callback)
+        {
+            const auto size = m_size.load(std::memory_order_acquire);
+
+            for (auto index = 0u; size > index; ++index)
+            {
+                const auto generation = at(index).generation.load(std::memory_order_acquire);
+
+                if (generation % 2 == 0)
+                {
+                    continue;
+                }
+
+                auto value = release(index, generation);
+
+                if (!value)
+                {
+                    continue;
+                }
+
+                std::invoke(callback, std::move(value.value()));
+            }
+        }
+    };
+} // namespace saucer
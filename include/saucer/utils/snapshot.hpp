@@ -0,0 +1,56 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <atomic>
+
+#include <concepts>
+#include <functional>
+
+namespace saucer
+{
+    template <typename T>
+    class snapshot
+    {
+        using pointer = std::shared_ptr<const T>;
+
+      private:
+        std::mutex m_mutex;
+
+#ifdef __cpp_lib_atomic_shared_ptr
+        std::atomic<pointer> m_data;
+#else
+        pointer m_data;
+#endif
+
+      public:
+        snapshot() : m_data(std::make_shared<const T>()) {}
+
+      public:
+        [[nodiscard]] pointer load() const
+        {
+#ifdef __cpp_lib_atomic_shared_ptr
+            return m_data.load(std::memory_order_acquire);
+#else
+            return std::atomic_load_explicit(&m_data, std::memory_order_acquire);
+#endif
+        }
+
+      public:
+        template <typename Callback>
+            requires std::invocable<Callback, T &>
+        void update(Callback &&callback)
+        {
+            std::lock_guard guard{m_mutex};
+
+            auto copy = std::make_shared<T>(*load());
+            std::invoke(std::forward<Callback>(callback), *copy);
+
+#ifdef __cpp_lib_atomic_shared_ptr
+            m_data.store(std::move(copy), std::memory_order_release);
+#else
+            std::atomic_store_explicit(&m_data, pointer{std::move(copy)}, std::memory_order_release);
+#endif
+        }
+    };
+} // namespace saucer
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "tuple.hpp"
+#include "../task.hpp"
 #include "../executor.hpp"
 
 #include <utility>
 #include <type_traits>
 
 #include <tuple>
+#include <string>
 #include <expected>
+#include <exception>
 
 #include <boost/callable_traits.hpp>
 
@@ -46,6 +49,42 @@ namespace saucer::traits
         {
         };
 
+        template <typename T>
+        struct is_executor : std::false_type
+        {
+        };
+
+        template <typename T, typename E>
+        struct is_executor<executor<T, E>> : std::true_type
+        {
+        };
+
+        template <typename T>
+        struct is_stream : std::false_type
+        {
+        };
+
+        template <typename T, typename E>
+        struct is_stream<stream<T, E>> : std::true_type
+        {
+        };
+
+        inline std::string what(const std::exception_ptr &exception)
+        {
+            try
+            {
+                std::rethrow_exception(exception);
+            }
+            catch (const std::exception &error)
+            {
+                return error.what();
+            }
+            catch (...)
+            {
+                return "Unknown exception";
+            }
+        }
+
         template <typename T, typename D = std::decay_t<T>>
         using arg_transformer_t = std::conditional_t<std::same_as<D, std::string_view>, std::string, D>;
     } // namespace impl
@@ -61,6 +100,12 @@ namespace saucer::traits
     template <typename T>
     static constexpr auto has_reference_v = impl::has_reference<T>::value;
 
+    template <typename T>
+    static constexpr auto is_executor_v = impl::is_executor<T>::value;
+
+    template <typename T>
+    static constexpr auto is_stream_v = impl::is_stream<T>::value;
+
     template <typename T>
     using raw_args_t = boost::callable_traits::args_t<T>;
 
@@ -126,6 +171,35 @@ namespace saucer::traits
         }
     };
 
+    template <typename T, typename... Ts, typename R, typename E>
+    struct converter<T, std::tuple<Ts...>, executor<R, E>, apply_failure, apply_success<task<R>>>
+    {
+        static decltype(auto) convert(T callable)
+        {
+            return [callable = std::move(callable)](Ts &&...args, auto &&executor) mutable
+            {
+                auto settle = [executor](typename task<R>::result_type result)
+                {
+                    if (!result)
+                    {
+                        return std::invoke(executor.reject, impl::what(result.error()));
+                    }
+
+                    if constexpr (std::is_void_v<R>)
+                    {
+                        std::invoke(executor.resolve);
+                    }
+                    else
+                    {
+                        std::invoke(executor.resolve, std::move(result.value()));
+                    }
+                };
+
+                std::invoke(callable, std::forward<Ts>(args)...).then(std::move(settle));
+            };
+        }
+    };
+
     template <typename T, typename Result = result_t<T>, typename Last = tuple::last_t<args_t<T>>>
         requires(!has_reference_v<raw_args_t<T>>)
     struct resolver
@@ -151,6 +225,31 @@ namespace saucer::traits
         using converter = traits::converter<T, args, executor>;
     };
 
+    template <typename T, typename Result, typename R, typename E>
+    struct resolver<T, Result, stream<R, E>>
+    {
+        using args     = tuple::drop_last_t<args_t<T>>;
+        using error    = E;
+        using result   = R;
+        using executor = saucer::stream<R, E>;
+
+      public:
+        using converter = traits::converter<T, args, executor>;
+    };
+
+    template <typename T, typename R, typename Last>
+        requires(!is_executor_v<Last> && !is_stream_v<Last>)
+    struct resolver<T, task<R>, Last>
+    {
+        using args     = args_t<T>;
+        using error    = std::string;
+        using result   = R;
+        using executor = saucer::executor<R, std::string>;
+
+      public:
+        using converter = traits::converter<T, args, executor>;
+    };
+
     template <typename T, typename R, typename E, typename Last>
     struct resolver<T, std::expected<R, E>, Last>
     {
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "window.hpp"
+#include "router.hpp"
+#include "emitter.hpp"
+#include "embedded.hpp"
 
 #include "stash/stash.hpp"
 #include "modules/module.hpp"
@@ -9,6 +12,7 @@
 #include "script.hpp"
 
 #include "scheme.hpp"
+#include "throttle.hpp"
 #include "navigation.hpp"
 
 #include <array>
@@ -18,6 +22,7 @@
 #include <unordered_map>
 
 #include <string>
+#include <vector>
 #include <memory>
 
 #include <ereignis/manager.hpp>
@@ -44,12 +49,7 @@ namespace saucer
     {
         sync,
         async,
-    };
-
-    struct embedded_file
-    {
-        stash<> content;
-        std::string mime;
+        serial,
     };
 
     using color = std::array<std::uint8_t, 4>;
@@ -59,7 +59,7 @@ namespace saucer
         struct impl;
 
       private:
-        using embedded_files = std::unordered_map<std::string, embedded_file>;
+        using embedded_files = embedded_store::files;
 
       protected:
         using window::m_parent;
@@ -76,15 +76,30 @@ namespace saucer
 
       private:
         events m_events;
-        embedded_files m_embedded_files;
+        router m_router;
+        batch m_batch;
+        emitter m_emitter;
+        scheme::resolver m_bridge;
+        embedded_store m_embedded;
 
       protected:
         std::unique_ptr<impl> m_impl;
 
       protected:
-        virtual bool on_message(const std::string &);
+        virtual void on_unload();
+        virtual bool on_message(const message &);
         void handle_scheme(const std::string &, scheme::resolver &&, launch);
 
+      protected:
+        void handle_bridge(scheme::resolver &&);
+
+      private:
+        bool settle(const std::vector<std::string> &);
+        void handle_saucer(launch);
+
+      private:
+        scheme::resolver serialize(scheme::resolver &&);
+
       protected:
         void reject(std::uint64_t, const std::string &);
         void resolve(std::uint64_t, const std::string &);
@@ -144,13 +159,21 @@ namespace saucer
 
       public:
         [[sc::thread_safe]] void inject(const script &script);
-        [[sc::thread_safe]] void execute(const std::string &code);
+        [[sc::thread_safe]] bool execute(const std::string &code);
+
+      public:
+        [[sc::thread_safe]] bool emit(const std::string &channel, std::string payload, coalesce policy = coalesce::none);
+        [[sc::thread_safe]] [[nodiscard]] std::size_t pending_events() const;
 
       public:
         template <typename T>
         [[sc::thread_safe]] void handle_scheme(const std::string &name, T &&handler, launch policy = launch::sync);
         [[sc::thread_safe]] void remove_scheme(const std::string &name);
 
+      public:
+        [[sc::thread_safe]] void claim(std::string tag, router::handler handler);
+        [[sc::thread_safe]] void unclaim(const std::string &tag);
+
       public:
         using window::clear;
         [[sc::thread_safe]] void clear(web_event event);
@@ -9,6 +9,13 @@ namespace saucer
     void webview::handle_scheme(const std::string &name, T &&handler, launch policy)
     {
         using converter = traits::converter<T, std::tuple<scheme::request>, scheme::executor>;
-        handle_scheme(name, scheme::resolver{converter::convert(std::forward<T>(handler))}, policy);
+        auto resolver   = scheme::resolver{converter::convert(std::forward<T>(handler))};
+
+        if (policy != launch::serial)
+        {
+            return handle_scheme(name, std::move(resolver), policy);
+        }
+
+        handle_scheme(name, serialize(std::move(resolver)), launch::sync);
     }
 } // namespace saucer
@@ -5,6 +5,7 @@
 
 #include "app.hpp"
 #include "icon.hpp"
+#include "batch.hpp"
 
 #include <string>
 #include <memory>
@@ -65,6 +66,9 @@ namespace saucer
         fs::path storage_path;
         std::string user_agent;
         std::set<std::string> browser_flags;
+
+      public:
+        batch_options batching{};
     };
 
     struct window
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace saucer::scheme::encoding
+{
+    // Implemented by the backends: Whether the engine itself decodes scheme responses that carry a `Content-Encoding`.
+    [[nodiscard]] bool passthrough();
+
+    // Embedded content is trusted to be reasonable, but a corrupt or malicious file must not be able to exhaust memory.
+    static constexpr std::size_t limit = 256 * 1024 * 1024;
+
+    [[nodiscard]] bool supported(std::string_view encoding);
+    [[nodiscard]] bool accepts(const request &, std::string_view encoding);
+
+    [[nodiscard]] std::optional<std::vector<std::uint8_t>> decode(std::string_view encoding, std::span<const std::uint8_t>);
+} // namespace saucer::scheme::encoding
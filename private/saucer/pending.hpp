@@ -0,0 +1,22 @@
+#pragma once
+
+#include <deque>
+#include <string>
+
+namespace saucer
+{
+    class pending_scripts
+    {
+        std::size_t m_size{0};
+        std::deque<std::string> m_scripts;
+
+      public:
+        static constexpr std::size_t limit = 8 * 1024 * 1024;
+
+      public:
+        [[nodiscard]] bool push(std::string code);
+
+      public:
+        [[nodiscard]] std::deque<std::string> flush();
+    };
+} // namespace saucer
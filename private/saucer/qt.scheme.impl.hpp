@@ -3,7 +3,9 @@
 #include "scheme.hpp"
 
 #include "webview.hpp"
+#include "writer.impl.hpp"
 
+#include <QIODevice>
 #include <QWebEngineUrlRequestJob>
 #include <QWebEngineUrlSchemeHandler>
 
@@ -17,6 +19,50 @@ namespace saucer::scheme
         QByteArray body;
     };
 
+    class stash_device : public QIODevice
+    {
+        stash<> m_data;
+
+      public:
+        stash_device(stash<>);
+
+      public:
+        [[nodiscard]] bool isSequential() const override;
+
+      public:
+        [[nodiscard]] qint64 size() const override;
+        [[nodiscard]] qint64 bytesAvailable() const override;
+
+      protected:
+        qint64 readData(char *, qint64) override;
+        qint64 writeData(const char *, qint64) override;
+    };
+
+    class writer_device : public QIODevice
+    {
+        std::shared_ptr<writer::impl> m_writer;
+
+      public:
+        writer_device(std::shared_ptr<writer::impl>);
+
+      public:
+        ~writer_device() override;
+
+      public:
+        [[nodiscard]] bool atEnd() const override;
+        [[nodiscard]] bool isSequential() const override;
+
+      public:
+        [[nodiscard]] qint64 bytesAvailable() const override;
+
+      protected:
+        qint64 readData(char *, qint64) override;
+        qint64 writeData(const char *, qint64) override;
+
+      private:
+        void notify();
+    };
+
     class handler : public QWebEngineUrlSchemeHandler
     {
         application *app;
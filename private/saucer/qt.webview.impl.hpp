@@ -1,6 +1,7 @@
 #pragma once
 
 #include "webview.hpp"
+#include "pending.hpp"
 #include "qt.scheme.impl.hpp"
 
 #include <string>
@@ -35,7 +36,7 @@ namespace saucer
 
       public:
         bool dom_loaded{false};
-        std::vector<std::string> pending;
+        pending_scripts pending;
 
       public:
         std::vector<script> permanent_scripts;
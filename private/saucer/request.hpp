@@ -6,6 +6,8 @@
 #include <cstdint>
 #include <optional>
 
+#include <string_view>
+
 namespace saucer::request
 {
     struct start_resize
@@ -48,5 +50,5 @@ namespace saucer::request
     using request = std::variant<start_resize, start_drag, maximize, minimize, close, maximized, minimized>;
 
     [[nodiscard]] std::string stubs();
-    [[nodiscard]] std::optional<request> parse(const std::string &);
+    [[nodiscard]] std::optional<request> parse(std::string_view tag, std::string_view);
 } // namespace saucer::request
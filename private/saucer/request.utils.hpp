@@ -3,6 +3,8 @@
 #include "request.hpp"
 
 #include <array>
+#include <utility>
+#include <functional>
 #include <string_view>
 
 #include <fmt/compile.h>
@@ -42,4 +44,30 @@ namespace saucer::request::utils
 
     template <typename T>
     static constexpr auto is_request = impl::contains<T, request>::value;
+
+    template <typename Callback>
+    std::optional<request> find(std::string_view name, Callback &&callback)
+    {
+        std::optional<request> rtn;
+
+        auto visit = [&]<typename T>()
+        {
+            if (name != tag<T>)
+            {
+                return false;
+            }
+
+            rtn = std::invoke(callback, std::type_identity<T>{});
+            return true;
+        };
+
+        auto unpack = [&]<auto... Is>(std::index_sequence<Is...>)
+        {
+            (visit.template operator()<std::variant_alternative_t<Is, request>>() || ...);
+        };
+
+        unpack(std::make_index_sequence<std::variant_size_v<request>>());
+
+        return rtn;
+    }
 } // namespace saucer::request::utils
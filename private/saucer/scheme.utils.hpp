@@ -0,0 +1,23 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <map>
+#include <string>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace saucer::scheme::impl
+{
+    [[nodiscard]] bool iequals(std::string_view, std::string_view);
+    [[nodiscard]] std::optional<std::string_view> header(const std::map<std::string, std::string> &, std::string_view name);
+
+    [[nodiscard]] stash<> slice(stash<>, std::size_t offset, std::size_t length);
+
+    [[nodiscard]] response materialize(response);
+    [[nodiscard]] response apply_range(const request &, response);
+
+    [[nodiscard]] executor ranged(request, executor);
+    [[nodiscard]] executor buffered(executor);
+} // namespace saucer::scheme::impl
@@ -14,10 +14,17 @@ namespace saucer::scripts
             left:   1 << 2,
             right:  1 << 3,
         }},
+        on: (channel, callback) =>
+        {{
+            const {{ listeners }} = window.saucer.internal;
+            (listeners[channel] ??= new Set()).add(callback);
+
+            return () => listeners[channel].delete(callback);
+        }},
         internal: 
         {{
-            idc: 0,
-            rpc: [],
+            idc: Math.floor(Math.random() * 2 ** 32) * 2 ** 16,
+            rpc: Object.create(null),
             send: async (message, serializer = JSON.stringify) =>
             {{
                 const id = ++window.saucer.internal.idc;
@@ -43,11 +50,64 @@ namespace saucer::scripts
                     ...message,
                 }}));
             }},
+            listeners: Object.create(null),
+            emit: (events) =>
+            {{
+                // Animation frames are paused while the page is hidden, which would hold back the acknowledgement.
+                const schedule = document.hidden ? (callback) => setTimeout(callback)
+                                                 : (callback) => requestAnimationFrame(callback);
+
+                schedule(() =>
+                {{
+                    for (const [channel, payload] of events)
+                    {{
+                        for (const callback of window.saucer.internal.listeners[channel] ?? [])
+                        {{
+                            try
+                            {{
+                                callback(payload);
+                            }}
+                            catch (error)
+                            {{
+                                console.error(error);
+                            }}
+                        }}
+                    }}
+
+                    window.saucer.internal.message(JSON.stringify({{ ["saucer:emitted"]: true }}));
+                }});
+            }},
+            settle: (results) =>
+            {{
+                for (const [id, resolved, value] of results)
+                {{
+                    const rpc = window.saucer.internal.rpc[id];
+
+                    if (!rpc)
+                    {{
+                        continue;
+                    }}
+
+                    delete window.saucer.internal.rpc[id];
+                    resolved ? rpc.resolve(value) : rpc.reject(value);
+                }}
+            }},
             {internal}
         }},
         {stubs}
     }};
 
+    window.addEventListener("pagehide", () =>
+    {{
+        const {{ rpc }} = window.saucer.internal;
+        window.saucer.internal.rpc = Object.create(null);
+
+        for (const {{ reject }} of Object.values(rpc))
+        {{
+            reject("Page was unloaded before call finished");
+        }}
+    }});
+
     document.addEventListener("mousedown", async ({{ x, y, target, button, detail }}) => 
     {{
         if (button !== 0)
@@ -107,16 +167,164 @@ namespace saucer::scripts
     )js";
 
     static constexpr std::string_view smartview_script = R"js(
+    window.saucer.internal.handles  = Object.create(null);
+    window.saucer.internal.prepared = [];
+
     window.saucer.internal.resolve = async (id, value) =>
     {{
+        const {{ binary, upload }} = window.saucer.internal;
+
         await window.saucer.internal.message({serializer}({{
                 ["saucer:resolve"]: true,
                 id,
-                result: value === undefined ? null : value,
+                result: value === undefined ? null : binary(value) ? await upload(value) : value,
         }}));
     }}
+
+    window.saucer.internal.binary = (value) => value instanceof ArrayBuffer || ArrayBuffer.isView(value);
+
+    window.saucer.internal.upload = async (value) =>
+    {{
+        const response = await fetch("saucer://bridge/blob", {{ method: "POST", body: value }}).catch(() => null);
+
+        // Some backends (i.e. Qt5) can not read request bodies and refuse uploads, the data is then sent inline.
+
+        if (!response?.ok)
+        {{
+            return window.saucer.internal.inline(value);
+        }}
+
+        return {{ id: await response.text() }};
+    }}
+
+    window.saucer.internal.inline = (value) =>
+    {{
+        const raw = value instanceof ArrayBuffer || value instanceof DataView;
+        return Array.from(raw ? new Uint8Array(value.buffer ?? value, value.byteOffset ?? 0, value.byteLength) : value);
+    }}
+
+    window.saucer.internal.blob = async (id, type = "Uint8Array") =>
+    {{
+        const response = await fetch(`saucer://bridge/blob/${{id}}`);
+        return new globalThis[type](await response.arrayBuffer());
+    }}
+
+    window.saucer.internal.typed = (type, data) =>
+    {{
+        const binary = atob(data);
+        const bytes  = new Uint8Array(binary.length);
+
+        for (let i = 0; binary.length > i; i++)
+        {{
+            bytes[i] = binary.charCodeAt(i);
+        }}
+
+        return new globalThis[type](bytes.buffer);
+    }}
     
-    window.saucer.call = async (name, params) =>
+    window.saucer.internal.streams = [];
+
+    window.saucer.internal.stream = (id) =>
+    {{
+        const {{ streams }} = window.saucer.internal;
+
+        if (streams[id])
+        {{
+            return streams[id];
+        }}
+
+        const state = {{ buffer: [], done: false, failed: false, error: undefined, consumed: 0, wake: null }};
+
+        const notify = () =>
+        {{
+            state.wake?.();
+            state.wake = null;
+        }};
+
+        const credit = (amount) => window.saucer.internal.message(JSON.stringify({{ ["saucer:credit"]: [id, amount] }}));
+
+        const iterator = {{
+            next: async () =>
+            {{
+                while (!state.buffer.length && !state.done)
+                {{
+                    await new Promise(resolve => state.wake = resolve);
+                }}
+
+                if (state.buffer.length)
+                {{
+                    if (++state.consumed >= Math.max(1, {credits} / 2))
+                    {{
+                        credit(state.consumed);
+                        state.consumed = 0;
+                    }}
+
+                    return {{ value: state.buffer.shift(), done: false }};
+                }}
+
+                delete streams[id];
+
+                if (state.failed)
+                {{
+                    throw state.error;
+                }}
+
+                return {{ value: undefined, done: true }};
+            }},
+            return: async () =>
+            {{
+                if (!state.done)
+                {{
+                    state.done = true;
+                    credit(-1);
+                }}
+
+                delete streams[id];
+
+                return {{ value: undefined, done: true }};
+            }},
+        }};
+
+        streams[id] = {{
+            push: (value) =>
+            {{
+                state.buffer.push(value);
+                notify();
+            }},
+            finish: () =>
+            {{
+                state.done = true;
+                notify();
+            }},
+            reject: (error) =>
+            {{
+                state.done   = true;
+                state.failed = true;
+                state.error  = error;
+                notify();
+            }},
+            [Symbol.asyncIterator]: () => iterator,
+        }};
+
+        return streams[id];
+    }}
+
+    window.saucer.internal.iterable = (promise) =>
+    {{
+        promise[Symbol.asyncIterator] = () =>
+        {{
+            const iterator = promise.then(stream => stream[Symbol.asyncIterator]());
+
+            return {{
+                next: async () => (await iterator).next(),
+                return: async () => (await iterator).return(),
+            }};
+        }};
+
+        return promise;
+    }}
+
+    window.saucer.internal.call = async (name, params) =>
     {{
         if (!Array.isArray(params))
         {{
@@ -128,13 +336,17 @@ namespace saucer::scripts
             throw 'Bad name, expected string';
         }}
 
+        const {{ binary, upload }} = window.saucer.internal;
+
         return window.saucer.internal.send({{
             ["saucer:call"]: true,
-            name,
-            params,
+            name: window.saucer.internal.handles[name] ?? name,
+            params: await Promise.all(params.map(param => binary(param) ? upload(param) : param)),
         }}, {serializer});
     }}
 
+    window.saucer.call = (name, params) => window.saucer.internal.iterable(window.saucer.internal.call(name, params));
+
     window.saucer.exposed = new Proxy({{}}, {{
         get: (_, prop) => (...args) => window.saucer.call(prop, args),
     }});
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "webview.hpp"
+#include "pending.hpp"
 
 #include "cocoa.utils.hpp"
 #include "wk.scheme.impl.hpp"
@@ -38,7 +39,7 @@ namespace saucer
 
       public:
         bool dom_loaded{false};
-        std::vector<std::string> pending;
+        pending_scripts pending;
 
       public:
         template <web_event>
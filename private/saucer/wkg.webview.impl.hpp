@@ -1,6 +1,7 @@
 #pragma once
 
 #include "webview.hpp"
+#include "pending.hpp"
 
 #include "gtk.utils.hpp"
 #include "wkg.scheme.impl.hpp"
@@ -28,7 +29,7 @@ namespace saucer
 
       public:
         bool dom_loaded{false};
-        std::vector<std::string> pending;
+        pending_scripts pending;
 
       public:
         utils::g_object_ptr<WebKitSettings> settings;
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "scheme.hpp"
+
+#include <span>
+#include <deque>
+#include <mutex>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+namespace saucer::scheme
+{
+    struct writer::impl
+    {
+        std::mutex mutex;
+        std::condition_variable cv;
+
+      public:
+        // Guards `notify` separately, so that it is never invoked while `mutex` is held, but can not outlive `close`.
+        std::mutex notifying;
+
+      public:
+        std::deque<stash<>> chunks;
+        std::size_t offset{0};
+        std::size_t buffered{0};
+        std::size_t capacity;
+
+      public:
+        bool closed{false};
+        bool finished{false};
+        bool collecting{false};
+
+      public:
+        // Set once a reader consumes the stream, producers are only held back from then on.
+        bool attached{false};
+
+      public:
+        std::function<void()> notify;
+        std::function<void(stash<>)> collector;
+
+      public:
+        [[nodiscard]] bool eof();
+        [[nodiscard]] bool full(std::size_t);
+        [[nodiscard]] std::size_t available();
+        [[nodiscard]] std::size_t read(std::span<std::uint8_t>);
+
+      public:
+        void wait(std::chrono::milliseconds);
+
+      public:
+        void finish();
+        void close();
+
+      public:
+        void signal();
+        void subscribe(std::function<void()>);
+        void collect(std::function<void(stash<>)>);
+
+      public:
+        // Expects the mutex to be held
+        stash<> take();
+    };
+} // namespace saucer::scheme
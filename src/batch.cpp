@@ -0,0 +1,137 @@
+#include "batch.hpp"
+
+#include "app.hpp"
+
+#include <mutex>
+#include <utility>
+#include <iterator>
+
+namespace saucer
+{
+    struct batch::impl
+    {
+        application *app;
+
+      public:
+        batch_options options;
+        batch::callback callback;
+
+      public:
+        std::mutex mutex;
+        bool scheduled{false};
+        std::vector<std::string> pending;
+
+      public:
+        static constexpr std::chrono::milliseconds retry{50};
+
+      public:
+        void flush(const std::shared_ptr<impl> &);
+        void defer(const std::shared_ptr<impl> &, std::chrono::milliseconds);
+        void schedule(const std::shared_ptr<impl> &, bool immediate);
+    };
+
+    void batch::impl::flush(const std::shared_ptr<impl> &self)
+    {
+        std::vector<std::string> entries;
+
+        {
+            const std::lock_guard guard{mutex};
+
+            entries   = std::exchange(pending, {});
+            scheduled = false;
+        }
+
+        if (entries.empty() || std::invoke(callback, entries))
+        {
+            return;
+        }
+
+        // The entries could not be delivered (e.g. the script queue of a loading page is full), instead of dropping them
+        // they are put back in front of newer ones and retried shortly.
+
+        bool schedule{};
+
+        {
+            const std::lock_guard guard{mutex};
+
+            pending.insert(pending.begin(), std::make_move_iterator(entries.begin()),
+                           std::make_move_iterator(entries.end()));
+            schedule = !std::exchange(scheduled, true);
+        }
+
+        if (!schedule)
+        {
+            return;
+        }
+
+        defer(self, retry);
+    }
+
+    void batch::impl::defer(const std::shared_ptr<impl> &self, std::chrono::milliseconds delay)
+    {
+        auto flush = [weak = std::weak_ptr{self}]
+        {
+            auto locked = weak.lock();
+
+            if (!locked)
+            {
+                return;
+            }
+
+            locked->flush(locked);
+        };
+
+        if (delay.count() <= 0)
+        {
+            return app->post(std::move(flush));
+        }
+
+        app->post(std::move(flush), delay);
+    }
+
+    void batch::impl::schedule(const std::shared_ptr<impl> &self, bool immediate)
+    {
+        if (immediate && app->thread_safe())
+        {
+            return flush(self);
+        }
+
+        defer(self, immediate ? std::chrono::milliseconds{0} : options.latency);
+    }
+
+    batch::batch(application *app, batch_options options, callback flush) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->app      = app;
+        m_impl->options  = options;
+        m_impl->callback = std::move(flush);
+    }
+
+    batch::~batch() = default;
+
+    void batch::push(std::string entry)
+    {
+        bool full{};
+        bool schedule{};
+
+        {
+            const std::lock_guard guard{m_impl->mutex};
+
+            m_impl->pending.emplace_back(std::move(entry));
+
+            full     = m_impl->pending.size() >= m_impl->options.max_size;
+            schedule = !std::exchange(m_impl->scheduled, true);
+        }
+
+        if (!full && !schedule)
+        {
+            return;
+        }
+
+        m_impl->schedule(m_impl, full);
+    }
+
+    void batch::flush()
+    {
+        m_impl->schedule(m_impl, true);
+    }
+} // namespace saucer
@@ -0,0 +1,116 @@
+#include "bridge.hpp"
+
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include <fmt/core.h>
+
+namespace saucer::bridge
+{
+    struct blobs::impl
+    {
+        std::mutex mutex;
+        std::random_device random;
+
+      public:
+        std::size_t size{0};
+        std::unordered_map<std::string, stash<>> entries;
+
+      public:
+        std::string generate();
+    };
+
+    std::string blobs::impl::generate()
+    {
+        // Blob ids are handed to the page and are the only thing guarding the data, they have to be unguessable.
+
+        std::string rtn;
+
+        do
+        {
+            rtn = fmt::format("{:08x}{:08x}{:08x}{:08x}", random(), random(), random(), random());
+        } while (entries.contains(rtn));
+
+        return rtn;
+    }
+
+    blobs::blobs() : m_impl(std::make_unique<impl>()) {}
+
+    blobs::~blobs() = default;
+
+    std::optional<std::string> blobs::store(stash<> data)
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        if (m_impl->size + data.size() > limit)
+        {
+            return std::nullopt;
+        }
+
+        auto id = m_impl->generate();
+
+        m_impl->size += data.size();
+        m_impl->entries.emplace(id, std::move(data));
+
+        return id;
+    }
+
+    std::optional<stash<>> blobs::take(const std::string &id)
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        auto it = m_impl->entries.find(id);
+
+        if (it == m_impl->entries.end())
+        {
+            return std::nullopt;
+        }
+
+        auto rtn = std::move(it->second);
+
+        m_impl->size -= rtn.size();
+        m_impl->entries.erase(it);
+
+        return rtn;
+    }
+
+    void blobs::clear()
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        m_impl->size = 0;
+        m_impl->entries.clear();
+    }
+
+    std::string encode(std::span<const std::uint8_t> data)
+    {
+        static constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::string rtn;
+        rtn.reserve(((data.size() + 2) / 3) * 4);
+
+        for (auto i = 0uz; data.size() > i; i += 3)
+        {
+            const auto remaining = data.size() - i;
+            std::uint32_t chunk  = data[i] << 16;
+
+            if (remaining > 1)
+            {
+                chunk |= data[i + 1] << 8;
+            }
+
+            if (remaining > 2)
+            {
+                chunk |= data[i + 2];
+            }
+
+            rtn += alphabet[(chunk >> 18) & 0x3f];
+            rtn += alphabet[(chunk >> 12) & 0x3f];
+            rtn += remaining > 1 ? alphabet[(chunk >> 6) & 0x3f] : '=';
+            rtn += remaining > 2 ? alphabet[chunk & 0x3f] : '=';
+        }
+
+        return rtn;
+    }
+} // namespace saucer::bridge
@@ -57,6 +57,22 @@ namespace saucer
                        });
     }
 
+    void application::post(callback_t callback, std::chrono::milliseconds delay) const // NOLINT(*-static)
+    {
+        auto *const queue = dispatch_get_main_queue();
+        auto *const ptr   = new callback_t{std::move(callback)};
+        const auto when   = dispatch_time(DISPATCH_TIME_NOW, std::chrono::nanoseconds{delay}.count());
+
+        dispatch_after(when, queue,
+                       [ptr]
+                       {
+                           const utils::autorelease_guard guard{};
+
+                           auto callback = std::unique_ptr<callback_t>{ptr};
+                           std::invoke(*callback);
+                       });
+    }
+
     template <>
     void application::run<true>() const // NOLINT(*-static)
     {
@@ -0,0 +1,384 @@
+#include "embedded.hpp"
+#include "encoding.hpp"
+
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <numeric>
+#include <algorithm>
+
+#include <fmt/core.h>
+
+namespace saucer
+{
+    using decoded = std::shared_future<std::shared_ptr<stash<>>>;
+
+    struct embedded_store::source
+    {
+        std::shared_ptr<stash<>> content;
+        std::string mime;
+        std::string encoding;
+
+      public:
+        std::string etag;
+        std::optional<saucer::decoded> decoded;
+    };
+
+    struct embedded_store::table
+    {
+        struct entry
+        {
+            std::string file;
+            std::optional<scheme::response> identity;
+
+          public:
+            std::string encoding;
+            std::optional<scheme::response> encoded;
+
+          public:
+            std::optional<saucer::decoded> decoded;
+        };
+
+      public:
+        std::vector<std::uint32_t> seeds;
+        std::vector<std::optional<entry>> slots;
+
+      public:
+        [[nodiscard]] const entry *find(std::string_view) const;
+
+      public:
+        static std::uint64_t hash(std::string_view, std::uint64_t seed);
+        static std::shared_ptr<const table> build(const catalog &);
+    };
+
+    struct embedded_store::impl
+    {
+        std::mutex mutex;
+        catalog sources;
+
+      public:
+#ifdef __cpp_lib_atomic_shared_ptr
+        std::atomic<std::shared_ptr<const table>> current;
+#else
+        std::shared_ptr<const table> current;
+#endif
+
+      public:
+        void rebuild();
+        [[nodiscard]] std::shared_ptr<const table> load() const;
+    };
+
+    std::uint64_t embedded_store::table::hash(std::string_view key, std::uint64_t seed)
+    {
+        auto rtn = 0xcbf29ce484222325ull ^ (seed * 0x9e3779b97f4a7c15ull);
+
+        for (const auto c : key)
+        {
+            rtn ^= static_cast<std::uint8_t>(c);
+            rtn *= 0x100000001b3ull;
+        }
+
+        rtn ^= rtn >> 33;
+        rtn *= 0xff51afd7ed558ccdull;
+        rtn ^= rtn >> 33;
+        rtn *= 0xc4ceb93fe53ccd53ull;
+        rtn ^= rtn >> 33;
+
+        return rtn;
+    }
+
+    const embedded_store::table::entry *embedded_store::table::find(std::string_view file) const
+    {
+        if (slots.empty())
+        {
+            return nullptr;
+        }
+
+        const auto seed  = seeds[hash(file, 0) % seeds.size()];
+        const auto &slot = slots[hash(file, seed) % slots.size()];
+
+        if (!slot.has_value() || slot->file != file)
+        {
+            return nullptr;
+        }
+
+        return &slot.value();
+    }
+
+    std::shared_ptr<const embedded_store::table> embedded_store::table::build(const catalog &sources)
+    {
+        auto rtn = std::make_shared<table>();
+
+        if (sources.empty())
+        {
+            return rtn;
+        }
+
+        std::vector<const catalog::value_type *> items;
+        items.reserve(sources.size());
+
+        for (const auto &item : sources)
+        {
+            items.emplace_back(&item);
+        }
+
+        // Hash and displace: keys are grouped into buckets, then every bucket (largest first) searches for a seed that
+        // places all of its keys into free slots. A lookup thus only ever probes a single slot.
+
+        std::vector<std::vector<std::size_t>> buckets(items.size());
+
+        for (auto i = 0uz; items.size() > i; ++i)
+        {
+            buckets[hash(items[i]->first, 0) % buckets.size()].emplace_back(i);
+        }
+
+        std::vector<std::size_t> order(buckets.size());
+        std::iota(order.begin(), order.end(), 0uz);
+        std::ranges::stable_sort(order, std::ranges::greater{}, [&buckets](auto i) { return buckets[i].size(); });
+
+        std::vector<std::uint32_t> seeds;
+        std::vector<std::optional<std::size_t>> placed;
+
+        auto place = [&](const std::vector<std::size_t> &bucket)
+        {
+            static constexpr auto attempts = 1u << 16;
+
+            std::vector<std::size_t> candidates;
+            candidates.reserve(bucket.size());
+
+            for (auto seed = 1u; attempts > seed; ++seed)
+            {
+                candidates.clear();
+
+                for (const auto index : bucket)
+                {
+                    const auto slot = hash(items[index]->first, seed) % placed.size();
+
+                    if (placed[slot].has_value() || std::ranges::find(candidates, slot) != candidates.end())
+                    {
+                        break;
+                    }
+
+                    candidates.emplace_back(slot);
+                }
+
+                if (candidates.size() != bucket.size())
+                {
+                    continue;
+                }
+
+                for (auto i = 0uz; bucket.size() > i; ++i)
+                {
+                    placed[candidates[i]] = bucket[i];
+                }
+
+                return seed;
+            }
+
+            return 0u;
+        };
+
+        // Should a bucket not find a seed, which is unlikely but possible, the table is grown by a slot and rebuilt.
+
+        for (auto size = items.size(); seeds.empty(); ++size)
+        {
+            seeds.assign(buckets.size(), 0);
+            placed.assign(size, std::nullopt);
+
+            for (const auto bucket : order)
+            {
+                if (buckets[bucket].empty())
+                {
+                    continue;
+                }
+
+                if (seeds[bucket] = place(buckets[bucket]); seeds[bucket] != 0)
+                {
+                    continue;
+                }
+
+                seeds.clear();
+                break;
+            }
+        }
+
+        rtn->seeds = std::move(seeds);
+        rtn->slots.resize(placed.size());
+
+        for (auto i = 0uz; placed.size() > i; ++i)
+        {
+            if (!placed[i].has_value())
+            {
+                continue;
+            }
+
+            const auto &[file, source] = *items[placed[i].value()];
+            const auto &encoding       = source.encoding;
+
+            auto &entry = rtn->slots[i].emplace(file);
+
+            // Every table (and every response copy) shares the content the source was added with, it is never duplicated.
+
+            auto response = scheme::response{
+                .data    = stash<>::shared(source.content),
+                .mime    = source.mime,
+                .headers = {{"Access-Control-Allow-Origin", "*"}, {"ETag", fmt::format(R"("{}")", source.etag)}},
+            };
+
+            if (encoding.empty())
+            {
+                entry.identity.emplace(std::move(response));
+                continue;
+            }
+
+            response.headers.emplace("Vary", "Accept-Encoding");
+
+            if (source.decoded.has_value())
+            {
+                entry.decoded = source.decoded;
+                entry.identity.emplace(response).data = stash<>::lazy(source.decoded.value());
+            }
+
+            response.headers.emplace("Content-Encoding", encoding);
+            response.headers.at("ETag") = fmt::format(R"("{}-{}")", source.etag, encoding);
+
+            entry.encoding = encoding;
+            entry.encoded.emplace(std::move(response));
+        }
+
+        return rtn;
+    }
+
+    void embedded_store::impl::rebuild()
+    {
+        // Only the writers are serialized (by the mutex), lookups merely load the current table.
+
+#ifdef __cpp_lib_atomic_shared_ptr
+        current.store(table::build(sources), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&current, table::build(sources), std::memory_order_release);
+#endif
+    }
+
+    std::shared_ptr<const embedded_store::table> embedded_store::impl::load() const
+    {
+#ifdef __cpp_lib_atomic_shared_ptr
+        return current.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&current, std::memory_order_acquire);
+#endif
+    }
+
+    embedded_store::embedded_store() : m_impl(std::make_shared<impl>())
+    {
+        m_impl->rebuild();
+    }
+
+    embedded_store::~embedded_store() = default;
+
+    void embedded_store::add(files content)
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        // Validators only have to be unique within this process, as embedded files are immutable once added.
+
+        static const auto nonce = std::random_device{}();
+        static std::atomic_uint64_t generation{0};
+
+        for (auto &[name, file] : content)
+        {
+            if (m_impl->sources.contains(name))
+            {
+                continue;
+            }
+
+            auto etag    = fmt::format("{:x}-{:x}", nonce, generation++);
+            auto shared  = std::make_shared<stash<>>(std::move(file.content));
+            auto decoded = std::optional<saucer::decoded>{};
+
+            // Engines that do not decode (or advertise) the encoding are served the decompressed content instead, which is
+            // produced on first use and then kept for the lifetime of the file. Content that fails to decode yields null.
+
+            if (!file.encoding.empty() && scheme::encoding::supported(file.encoding))
+            {
+                auto decode = [content = shared, encoding = file.encoding] -> std::shared_ptr<stash<>>
+                {
+                    auto rtn = scheme::encoding::decode(encoding, {content->data(), content->size()});
+
+                    if (!rtn)
+                    {
+                        return nullptr;
+                    }
+
+                    return std::make_shared<stash<>>(stash<>::from(std::move(rtn.value())));
+                };
+
+                decoded = std::async(std::launch::deferred, std::move(decode)).share();
+            }
+
+            auto entry = source{
+                .content  = std::move(shared),
+                .mime     = std::move(file.mime),
+                .encoding = std::move(file.encoding),
+                .etag     = std::move(etag),
+                .decoded  = std::move(decoded),
+            };
+
+            m_impl->sources.emplace(name, std::move(entry));
+        }
+
+        m_impl->rebuild();
+    }
+
+    void embedded_store::remove(const std::string &file)
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        m_impl->sources.erase(file);
+        m_impl->rebuild();
+    }
+
+    void embedded_store::clear()
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        m_impl->sources.clear();
+        m_impl->rebuild();
+    }
+
+    std::expected<std::shared_ptr<const scheme::response>, scheme::error> embedded_store::find(
+        std::string_view file, const scheme::request &request) const
+    {
+        auto current      = m_impl->load();
+        const auto *entry = current->find(file);
+
+        if (!entry)
+        {
+            return std::unexpected{scheme::error::not_found};
+        }
+
+        if (entry->encoded.has_value() && scheme::encoding::accepts(request, entry->encoding))
+        {
+            return std::shared_ptr<const scheme::response>{std::move(current), &entry->encoded.value()};
+        }
+
+        if (!entry->identity.has_value())
+        {
+            return std::unexpected{scheme::error::not_found};
+        }
+
+        // Corrupt content is only detected once it is decoded, it must not be passed off as an empty file.
+
+        if (entry->decoded.has_value() && !entry->decoded->get())
+        {
+            return std::unexpected{scheme::error::failed};
+        }
+
+        return std::shared_ptr<const scheme::response>{std::move(current), &entry->identity.value()};
+    }
+} // namespace saucer
@@ -0,0 +1,185 @@
+#include "emitter.hpp"
+
+#include "app.hpp"
+
+#include <mutex>
+#include <vector>
+#include <iterator>
+#include <utility>
+#include <unordered_map>
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+
+namespace saucer
+{
+    struct emitter::impl
+    {
+        application *app;
+        emitter::callback callback;
+
+      public:
+        std::mutex mutex;
+        bool scheduled{false};
+        std::size_t in_flight{0};
+
+      public:
+        std::vector<std::pair<std::string, std::string>> pending;
+        std::unordered_map<std::string, std::size_t> latest;
+
+      public:
+        void flush();
+        void schedule(const std::shared_ptr<impl> &);
+    };
+
+    void emitter::impl::flush()
+    {
+        std::vector<std::pair<std::string, std::string>> events;
+
+        {
+            const std::lock_guard guard{mutex};
+
+            scheduled = false;
+
+            // The page acknowledges every batch once it has been dispatched on an animation frame, until then updates
+            // keep accumulating (and coalescing) here instead of piling up in the web process.
+
+            if (in_flight > 0 || pending.empty())
+            {
+                return;
+            }
+
+            events    = std::exchange(pending, {});
+            in_flight = events.size();
+
+            latest.clear();
+        }
+
+        std::vector<std::string> entries;
+        entries.reserve(events.size());
+
+        for (const auto &[channel, payload] : events)
+        {
+            entries.emplace_back(fmt::format("[{:?}, {}]", channel, payload));
+        }
+
+        if (std::invoke(callback, fmt::format("window.saucer.internal.emit([{}]);", fmt::join(entries, ", "))))
+        {
+            return;
+        }
+
+        // The batch was refused (e.g. the script queue of a loading page is full), as no acknowledgement will ever arrive
+        // for it, the events are put back in front of newer ones and go out with the next flush.
+
+        const std::lock_guard guard{mutex};
+
+        for (auto &[channel, index] : latest)
+        {
+            index += events.size();
+        }
+
+        in_flight = 0;
+        pending.insert(pending.begin(), std::make_move_iterator(events.begin()), std::make_move_iterator(events.end()));
+    }
+
+    void emitter::impl::schedule(const std::shared_ptr<impl> &self)
+    {
+        auto flush = [weak = std::weak_ptr{self}]
+        {
+            auto locked = weak.lock();
+
+            if (!locked)
+            {
+                return;
+            }
+
+            locked->flush();
+        };
+
+        app->post(std::move(flush));
+    }
+
+    emitter::emitter(application *app, callback callback) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->app      = app;
+        m_impl->callback = std::move(callback);
+    }
+
+    emitter::~emitter() = default;
+
+    bool emitter::push(std::string channel, std::string payload, coalesce policy)
+    {
+        bool schedule{};
+
+        {
+            const std::lock_guard guard{m_impl->mutex};
+
+            auto &pending = m_impl->pending;
+            auto existing = m_impl->latest.find(channel);
+
+            if (policy == coalesce::latest && existing != m_impl->latest.end())
+            {
+                pending[existing->second].second = std::move(payload);
+            }
+            else if (pending.size() >= limit)
+            {
+                // Events that can not be coalesced are refused once the page falls too far behind, the caller is told
+                // so instead of letting the backlog grow without bounds.
+
+                return false;
+            }
+            else if (policy == coalesce::latest)
+            {
+                m_impl->latest.emplace(channel, pending.size());
+                pending.emplace_back(std::move(channel), std::move(payload));
+            }
+            else
+            {
+                pending.emplace_back(std::move(channel), std::move(payload));
+            }
+
+            schedule = m_impl->in_flight == 0 && !std::exchange(m_impl->scheduled, true);
+        }
+
+        if (schedule)
+        {
+            m_impl->schedule(m_impl);
+        }
+
+        return true;
+    }
+
+    void emitter::acknowledge()
+    {
+        bool schedule{};
+
+        {
+            const std::lock_guard guard{m_impl->mutex};
+
+            m_impl->in_flight = 0;
+            schedule          = !m_impl->pending.empty() && !std::exchange(m_impl->scheduled, true);
+        }
+
+        if (!schedule)
+        {
+            return;
+        }
+
+        m_impl->schedule(m_impl);
+    }
+
+    void emitter::reset()
+    {
+        const std::lock_guard guard{m_impl->mutex};
+
+        m_impl->in_flight = 0;
+        m_impl->pending.clear();
+        m_impl->latest.clear();
+    }
+
+    std::size_t emitter::pending() const
+    {
+        const std::lock_guard guard{m_impl->mutex};
+        return m_impl->pending.size() + m_impl->in_flight;
+    }
+} // namespace saucer
@@ -0,0 +1,180 @@
+#include "encoding.hpp"
+#include "scheme.utils.hpp"
+
+#include <ranges>
+#include <algorithm>
+
+#ifdef SAUCER_COMPRESSION
+#include <libdeflate.h>
+#include <brotli/decode.h>
+#endif
+
+namespace saucer::scheme::encoding
+{
+    namespace
+    {
+        std::string_view trim(std::string_view value)
+        {
+            static constexpr std::string_view whitespace = " \t";
+
+            const auto start = value.find_first_not_of(whitespace);
+
+            if (start == std::string_view::npos)
+            {
+                return {};
+            }
+
+            return value.substr(start, value.find_last_not_of(whitespace) - start + 1);
+        }
+
+#ifdef SAUCER_COMPRESSION
+        std::optional<std::vector<std::uint8_t>> gunzip(std::span<const std::uint8_t> data)
+        {
+            // The gzip trailer stores the decompressed size (modulo 2^32), which allows for a single decompression pass.
+            // It is not trusted though: Deflate can not expand data by more than ~1032:1, anything claiming more than that
+            // (or more than the limit) is corrupt and fails to decompress into the capped buffer.
+
+            static constexpr std::size_t ratio = 1032;
+
+            if (data.size() < 18)
+            {
+                return std::nullopt;
+            }
+
+            const auto *trailer = data.data() + data.size() - 4;
+            const auto claimed  = static_cast<std::size_t>(trailer[0]) | (static_cast<std::size_t>(trailer[1]) << 8) |
+                              (static_cast<std::size_t>(trailer[2]) << 16) | (static_cast<std::size_t>(trailer[3]) << 24);
+            const auto size     = std::min({claimed, data.size() * ratio, limit});
+
+            auto *decompressor = libdeflate_alloc_decompressor();
+
+            if (!decompressor)
+            {
+                return std::nullopt;
+            }
+
+            std::vector<std::uint8_t> rtn(size);
+            std::size_t written{};
+
+            const auto result = libdeflate_gzip_decompress(decompressor, data.data(), data.size(), rtn.data(), rtn.size(),
+                                                           &written);
+
+            libdeflate_free_decompressor(decompressor);
+
+            if (result != LIBDEFLATE_SUCCESS)
+            {
+                return std::nullopt;
+            }
+
+            rtn.resize(written);
+
+            return rtn;
+        }
+
+        std::optional<std::vector<std::uint8_t>> unbrotli(std::span<const std::uint8_t> data)
+        {
+            auto *state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+
+            if (!state)
+            {
+                return std::nullopt;
+            }
+
+            std::vector<std::uint8_t> rtn;
+
+            auto available_in = data.size();
+            const auto *in    = data.data();
+
+            auto result = BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT;
+
+            while (result == BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT)
+            {
+                const auto offset = rtn.size();
+
+                if (offset >= limit)
+                {
+                    break;
+                }
+
+                rtn.resize(std::min(std::max({offset * 2, data.size() * 4, 4096uz}), limit));
+
+                auto available_out = rtn.size() - offset;
+                auto *out          = rtn.data() + offset;
+
+                result = BrotliDecoderDecompressStream(state, &available_in, &in, &available_out, &out, nullptr);
+                rtn.resize(rtn.size() - available_out);
+            }
+
+            BrotliDecoderDestroyInstance(state);
+
+            if (result != BROTLI_DECODER_RESULT_SUCCESS)
+            {
+                return std::nullopt;
+            }
+
+            return rtn;
+        }
+#endif
+    } // namespace
+
+    bool supported([[maybe_unused]] std::string_view encoding)
+    {
+#ifdef SAUCER_COMPRESSION
+        return encoding == "gzip" || encoding == "br";
+#else
+        return false;
+#endif
+    }
+
+    bool accepts(const request &request, std::string_view encoding)
+    {
+        if (!passthrough())
+        {
+            return false;
+        }
+
+        const auto headers = request.headers();
+        const auto header  = impl::header(headers, "Accept-Encoding");
+
+        if (!header)
+        {
+            return false;
+        }
+
+        for (const auto part : std::views::split(header.value(), ','))
+        {
+            const auto entry   = std::string_view{part.begin(), part.end()};
+            const auto options = entry.find(';');
+
+            if (!impl::iequals(trim(entry.substr(0, options)), encoding))
+            {
+                continue;
+            }
+
+            // Only an explicit "q=0" opts out, other quality values are irrelevant as there is only a single variant.
+
+            const auto quality = options == std::string_view::npos ? std::string_view{} : trim(entry.substr(options + 1));
+            return !quality.starts_with("q=0") || quality.find_first_of("123456789") != std::string_view::npos;
+        }
+
+        return false;
+    }
+
+    std::optional<std::vector<std::uint8_t>> decode([[maybe_unused]] std::string_view encoding,
+                                                    [[maybe_unused]] std::span<const std::uint8_t> data)
+    {
+#ifdef SAUCER_COMPRESSION
+        if (encoding == "gzip")
+        {
+            return gunzip(data);
+        }
+
+        if (encoding == "br")
+        {
+            return unbrotli(data);
+        }
+#endif
+
+        return std::nullopt;
+    }
+} // namespace saucer::scheme::encoding
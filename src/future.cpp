@@ -0,0 +1,148 @@
+#include "utils/future.hpp"
+
+#include "app.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <condition_variable>
+
+namespace saucer::impl
+{
+    class reactor
+    {
+        using clock = std::chrono::steady_clock;
+
+      private:
+        struct entry
+        {
+            std::move_only_function<bool()> poll;
+
+          public:
+            clock::time_point next;
+            clock::duration interval;
+        };
+
+      private:
+        static constexpr auto initial = std::chrono::milliseconds(1);
+        static constexpr auto limit   = std::chrono::milliseconds(250);
+
+      private:
+        std::mutex m_mutex;
+        std::condition_variable_any m_cv;
+
+      private:
+        bool m_added{false};
+        std::vector<entry> m_pending;
+
+      private:
+        std::jthread m_thread;
+
+      private:
+        reactor();
+
+      private:
+        void run(const std::stop_token &);
+
+      public:
+        void watch(std::move_only_function<bool()>);
+
+      public:
+        static reactor &instance();
+    };
+
+    reactor::reactor() : m_thread([this](const std::stop_token &token) { run(token); }) {}
+
+    void reactor::run(const std::stop_token &token)
+    {
+        std::unique_lock guard{m_mutex};
+
+        while (!token.stop_requested())
+        {
+            if (m_pending.empty())
+            {
+                m_cv.wait(guard, token, [this] { return !m_pending.empty(); });
+                continue;
+            }
+
+            m_added      = false;
+            auto pending = std::exchange(m_pending, {});
+
+            guard.unlock();
+
+            // Every future backs off on its own: fresh ones are checked right away, while ones that stay pending are
+            // checked less and less often, so that long-running (or abandoned) futures do not keep the thread spinning.
+
+            const auto now = clock::now();
+
+            auto poll = [&now](entry &item)
+            {
+                if (item.next > now)
+                {
+                    return false;
+                }
+
+                if (std::invoke(item.poll))
+                {
+                    return true;
+                }
+
+                item.interval = std::min<clock::duration>(item.interval * 2, limit);
+                item.next     = now + item.interval;
+
+                return false;
+            };
+
+            std::erase_if(pending, poll);
+
+            guard.lock();
+            std::ranges::move(pending, std::back_inserter(m_pending));
+
+            if (m_pending.empty())
+            {
+                continue;
+            }
+
+            const auto next = std::ranges::min_element(m_pending, {}, &entry::next)->next;
+            m_cv.wait_until(guard, token, next, [this] { return m_added; });
+        }
+    }
+
+    void reactor::watch(std::move_only_function<bool()> poll)
+    {
+        {
+            const std::lock_guard guard{m_mutex};
+
+            m_added = true;
+            m_pending.emplace_back(entry{std::move(poll), clock::now(), initial});
+        }
+
+        m_cv.notify_one();
+    }
+
+    reactor &reactor::instance()
+    {
+        static reactor instance;
+        return instance;
+    }
+
+    void watch(std::move_only_function<bool()> poll)
+    {
+        reactor::instance().watch(std::move(poll));
+    }
+
+    void schedule(std::move_only_function<void()> callback)
+    {
+        auto app = application::active();
+
+        if (!app)
+        {
+            return std::invoke(callback);
+        }
+
+        app->pool().emplace(std::move(callback));
+    }
+} // namespace saucer::impl
@@ -28,6 +28,7 @@ struct glz::meta<saucer::serializers::glaze::result_data>
 namespace saucer::serializers::glaze
 {
     static constexpr auto opts = glz::opts{
+        .null_terminated       = false,
         .error_on_unknown_keys = true,
         .error_on_missing_keys = true,
         .raw_string            = false,
@@ -46,7 +47,7 @@ namespace saucer::serializers::glaze
     }
 
     template <typename T>
-    std::optional<T> parse_as(const std::string &buffer)
+    std::optional<T> parse_as(std::string_view buffer)
     {
         T value{};
 
@@ -58,18 +59,31 @@ namespace saucer::serializers::glaze
         return value;
     }
 
-    serializer::parse_result serializer::parse(const std::string &data) const
+    std::unique_ptr<saucer::function_data> serializer::parse_call(const message &data) const
     {
-        if (auto res = parse_as<function_data>(data); res.has_value())
+        auto res = parse_as<function_data>(data);
+
+        if (!res.has_value())
         {
-            return std::make_unique<function_data>(res.value());
+            return nullptr;
         }
 
-        if (auto res = parse_as<result_data>(data); res.has_value())
+        res->buffer = data;
+
+        return std::make_unique<function_data>(std::move(res.value()));
+    }
+
+    std::unique_ptr<saucer::result_data> serializer::parse_resolve(const message &data) const
+    {
+        auto res = parse_as<result_data>(data);
+
+        if (!res.has_value())
         {
-            return std::make_unique<result_data>(res.value());
+            return nullptr;
         }
 
-        return std::monostate{};
+        res->buffer = data;
+
+        return std::make_unique<result_data>(std::move(res.value()));
     }
 } // namespace saucer::serializers::glaze
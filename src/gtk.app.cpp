@@ -73,6 +73,18 @@ namespace saucer
         g_idle_add_once(reinterpret_cast<GSourceOnceFunc>(+once), new callback_t{std::move(callback)});
     }
 
+    void application::post(callback_t callback, std::chrono::milliseconds delay) const // NOLINT(*-static)
+    {
+        auto once = [](callback_t *data)
+        {
+            auto callback = std::unique_ptr<callback_t>{data};
+            std::invoke(*callback);
+        };
+
+        g_timeout_add_once(static_cast<guint>(delay.count()), reinterpret_cast<GSourceOnceFunc>(+once),
+                           new callback_t{std::move(callback)});
+    }
+
     template <bool Blocking>
     void application::run() const
     {
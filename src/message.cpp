@@ -0,0 +1,29 @@
+#include "message.hpp"
+
+namespace saucer
+{
+    message::message() = default;
+
+    message::message(std::string data)
+    {
+        auto owned = std::make_shared<const std::string>(std::move(data));
+
+        m_data  = *owned;
+        m_owner = std::move(owned);
+    }
+
+    message::message(std::string_view data, std::shared_ptr<const void> owner)
+        : m_owner(std::move(owner)), m_data(data)
+    {
+    }
+
+    std::string_view message::data() const
+    {
+        return m_data;
+    }
+
+    message::operator std::string_view() const
+    {
+        return m_data;
+    }
+} // namespace saucer
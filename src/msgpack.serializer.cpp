@@ -0,0 +1,723 @@
+#include "serializers/msgpack/msgpack.hpp"
+
+#include "bridge.hpp"
+
+#include <array>
+#include <cstdint>
+#include <variant>
+#include <optional>
+
+namespace saucer::serializers::msgpack
+{
+    static constexpr std::string_view codec = R"js(
+    window.saucer.internal.msgpack = (() =>
+    {
+        const encoder = new TextEncoder();
+        const decoder = new TextDecoder();
+
+        const base64 = (bytes) =>
+        {
+            let rtn = "";
+
+            for (let i = 0; bytes.length > i; i += 0x8000)
+            {
+                rtn += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));
+            }
+
+            return btoa(rtn);
+        };
+
+        const unbase64 = (data) =>
+        {
+            const binary = atob(data);
+            const rtn    = new Uint8Array(binary.length);
+
+            for (let i = 0; binary.length > i; i++)
+            {
+                rtn[i] = binary.charCodeAt(i);
+            }
+
+            return rtn;
+        };
+
+        const encode = (value) =>
+        {
+            let buffer = new Uint8Array(256);
+            let view   = new DataView(buffer.buffer);
+            let offset = 0;
+
+            const reserve = (size) =>
+            {
+                if (buffer.length >= offset + size)
+                {
+                    return offset;
+                }
+
+                let capacity = buffer.length * 2;
+
+                while (offset + size > capacity)
+                {
+                    capacity *= 2;
+                }
+
+                const next = new Uint8Array(capacity);
+                next.set(buffer);
+
+                buffer = next;
+                view   = new DataView(buffer.buffer);
+
+                return offset;
+            };
+
+            const take = (size) => { const rtn = reserve(size); offset += size; return rtn; };
+            const put  = (method, size, value) => { const at = take(size); view[method](at, value); };
+
+            const bytes = (data) => { const at = take(data.length); buffer.set(data, at); };
+
+            const u8  = (value) => put("setUint8", 1, value);
+            const u16 = (value) => put("setUint16", 2, value);
+            const u32 = (value) => put("setUint32", 4, value);
+
+            const length = (size, fixed, limit, [small, medium, large]) =>
+            {
+                if (fixed !== null && limit > size)
+                {
+                    return u8(fixed | size);
+                }
+
+                if (small !== null && 0x100 > size)
+                {
+                    u8(small);
+                    return u8(size);
+                }
+
+                if (0x10000 > size)
+                {
+                    u8(medium);
+                    return u16(size);
+                }
+
+                u8(large);
+                u32(size);
+            };
+
+            const float32 = (value) => { u8(0xca); put("setFloat32", 4, value); };
+            const float64 = (value) => { u8(0xcb); put("setFloat64", 8, value); };
+
+            const bigint = (value) =>
+            {
+                if (value >= 0n)
+                {
+                    u8(0xcf);
+                    return put("setBigUint64", 8, value);
+                }
+
+                u8(0xd3);
+                put("setBigInt64", 8, value);
+            };
+
+            const integer = (value) =>
+            {
+                if (value >= 0)
+                {
+                    if (0x80 > value) return u8(value);
+                    if (0x100 > value) { u8(0xcc); return u8(value); }
+                    if (0x10000 > value) { u8(0xcd); return u16(value); }
+                    if (0x100000000 > value) { u8(0xce); return u32(value); }
+
+                    return bigint(BigInt(value));
+                }
+
+                if (value >= -0x20) return u8(value & 0xff);
+                if (value >= -0x80) { u8(0xd0); return put("setInt8", 1, value); }
+                if (value >= -0x8000) { u8(0xd1); return put("setInt16", 2, value); }
+                if (value >= -0x80000000) { u8(0xd2); return put("setInt32", 4, value); }
+
+                bigint(BigInt(value));
+            };
+
+            const binary = (data) =>
+            {
+                length(data.byteLength, null, 0, [0xc4, 0xc5, 0xc6]);
+                bytes(new Uint8Array(data.buffer ?? data, data.byteOffset ?? 0, data.byteLength));
+            };
+
+            const elements = new Map([
+                [Float32Array, float32],
+                [Float64Array, float64],
+                [BigInt64Array, bigint],
+                [BigUint64Array, bigint],
+            ]);
+
+            const write = (value) =>
+            {
+                if (value === null || value === undefined)
+                {
+                    return u8(0xc0);
+                }
+
+                switch (typeof value)
+                {
+                case "boolean":
+                    return u8(value ? 0xc3 : 0xc2);
+                case "number":
+                    return Number.isSafeInteger(value) ? integer(value) : float64(value);
+                case "bigint":
+                    return bigint(value);
+                case "string":
+                {
+                    const data = encoder.encode(value);
+                    length(data.length, 0xa0, 32, [0xd9, 0xda, 0xdb]);
+                    return bytes(data);
+                }
+                }
+
+                if (value instanceof ArrayBuffer || value instanceof DataView || value instanceof Uint8Array || value instanceof Uint8ClampedArray)
+                {
+                    return binary(value);
+                }
+
+                if (ArrayBuffer.isView(value))
+                {
+                    const element = elements.get(value.constructor) ?? write;
+                    length(value.length, 0x90, 16, [null, 0xdc, 0xdd]);
+
+                    for (let i = 0; value.length > i; i++)
+                    {
+                        element(value[i]);
+                    }
+
+                    return;
+                }
+
+                if (Array.isArray(value))
+                {
+                    length(value.length, 0x90, 16, [null, 0xdc, 0xdd]);
+                    return value.forEach(item => write(item));
+                }
+
+                if (typeof value.toJSON === "function")
+                {
+                    return write(value.toJSON());
+                }
+
+                const entries = Object.entries(value).filter(([, item]) => item !== undefined && typeof item !== "function");
+                length(entries.length, 0x80, 16, [null, 0xde, 0xdf]);
+
+                for (const [key, item] of entries)
+                {
+                    write(key);
+                    write(item);
+                }
+            };
+
+            write(value);
+
+            return buffer.subarray(0, offset);
+        };
+
+        const decode = (data) =>
+        {
+            const bytes = typeof data === "string" ? unbase64(data) : data;
+            const view  = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+
+            let offset = 0;
+
+            const take   = (size) => { const rtn = offset; offset += size; return rtn; };
+            const string = (size) => decoder.decode(bytes.subarray(offset, offset += size));
+            const binary = (size) => bytes.slice(offset, offset += size);
+
+            const array = (size) =>
+            {
+                const rtn = new Array(size);
+
+                for (let i = 0; size > i; i++)
+                {
+                    rtn[i] = read();
+                }
+
+                return rtn;
+            };
+
+            const map = (size) =>
+            {
+                const rtn = {};
+
+                for (let i = 0; size > i; i++)
+                {
+                    const key = read();
+                    rtn[key]  = read();
+                }
+
+                return rtn;
+            };
+
+            const read = () =>
+            {
+                const type = view.getUint8(take(1));
+
+                if (0x80 > type) return type;
+                if (0x90 > type) return map(type & 0x0f);
+                if (0xa0 > type) return array(type & 0x0f);
+                if (0xc0 > type) return string(type & 0x1f);
+                if (type >= 0xe0) return type - 0x100;
+
+                switch (type)
+                {
+                case 0xc0: return null;
+                case 0xc2: return false;
+                case 0xc3: return true;
+                case 0xc4: return binary(view.getUint8(take(1)));
+                case 0xc5: return binary(view.getUint16(take(2)));
+                case 0xc6: return binary(view.getUint32(take(4)));
+                case 0xca: return view.getFloat32(take(4));
+                case 0xcb: return view.getFloat64(take(8));
+                case 0xcc: return view.getUint8(take(1));
+                case 0xcd: return view.getUint16(take(2));
+                case 0xce: return view.getUint32(take(4));
+                case 0xcf: return Number(view.getBigUint64(take(8)));
+                case 0xd0: return view.getInt8(take(1));
+                case 0xd1: return view.getInt16(take(2));
+                case 0xd2: return view.getInt32(take(4));
+                case 0xd3: return Number(view.getBigInt64(take(8)));
+                case 0xd9: return string(view.getUint8(take(1)));
+                case 0xda: return string(view.getUint16(take(2)));
+                case 0xdb: return string(view.getUint32(take(4)));
+                case 0xdc: return array(view.getUint16(take(2)));
+                case 0xdd: return array(view.getUint32(take(4)));
+                case 0xde: return map(view.getUint16(take(2)));
+                case 0xdf: return map(view.getUint32(take(4)));
+                }
+
+                throw `Unsupported msgpack type: ${type}`;
+            };
+
+            return read();
+        };
+
+        const message = (value) =>
+        {
+            if (value["saucer:call"])
+            {
+                return `saucer:call;${base64(encode([value.id, value.name, value.params]))}`;
+            }
+
+            if (value["saucer:resolve"])
+            {
+                return `saucer:resolve;${base64(encode([value.id, value.result]))}`;
+            }
+
+            return JSON.stringify(value);
+        };
+
+        return { encode, decode, message };
+    })();
+    )js";
+
+    static constexpr std::string_view alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string impl::encode(std::span<const char> data)
+    {
+        return bridge::encode({reinterpret_cast<const std::uint8_t *>(data.data()), data.size()});
+    }
+
+    std::optional<std::string> impl::decode(std::string_view data)
+    {
+        static constexpr auto lookup = []
+        {
+            std::array<std::int8_t, 256> rtn{};
+            rtn.fill(-1);
+
+            for (auto i = 0uz; alphabet.size() > i; ++i)
+            {
+                rtn[static_cast<std::uint8_t>(alphabet[i])] = static_cast<std::int8_t>(i);
+            }
+
+            return rtn;
+        }();
+
+        while (data.ends_with('='))
+        {
+            data.remove_suffix(1);
+        }
+
+        if (data.size() % 4 == 1)
+        {
+            return std::nullopt;
+        }
+
+        std::string rtn;
+        rtn.reserve((data.size() * 3) / 4);
+
+        std::uint32_t chunk{0};
+        std::size_t bits{0};
+
+        for (const auto &character : data)
+        {
+            const auto value = lookup[static_cast<std::uint8_t>(character)];
+
+            if (value < 0)
+            {
+                return std::nullopt;
+            }
+
+            chunk = (chunk << 6) | static_cast<std::uint32_t>(value);
+            bits += 6;
+
+            if (bits < 8)
+            {
+                continue;
+            }
+
+            bits -= 8;
+            rtn += static_cast<char>((chunk >> bits) & 0xff);
+        }
+
+        return rtn;
+    }
+
+    class reader
+    {
+        std::string_view m_data;
+        std::size_t m_offset{0};
+
+      public:
+        reader(std::string_view data) : m_data(data) {}
+
+      private:
+        std::optional<std::uint64_t> read(std::size_t size)
+        {
+            if (size > m_data.size() - m_offset)
+            {
+                return std::nullopt;
+            }
+
+            std::uint64_t rtn{0};
+
+            for (auto i = 0uz; size > i; ++i)
+            {
+                rtn = (rtn << 8) | static_cast<std::uint8_t>(m_data[m_offset++]);
+            }
+
+            return rtn;
+        }
+
+        bool advance(std::uint64_t size)
+        {
+            if (size > m_data.size() - m_offset)
+            {
+                return false;
+            }
+
+            m_offset += size;
+            return true;
+        }
+
+      public:
+        [[nodiscard]] std::size_t offset() const
+        {
+            return m_offset;
+        }
+
+        [[nodiscard]] std::string_view rest() const
+        {
+            return m_data.substr(m_offset);
+        }
+
+      public:
+        std::optional<std::uint64_t> array()
+        {
+            const auto type = read(1);
+
+            if (!type)
+            {
+                return std::nullopt;
+            }
+
+            if ((*type & 0xf0) == 0x90)
+            {
+                return *type & 0x0f;
+            }
+
+            switch (*type)
+            {
+            case 0xdc:
+                return read(2);
+            case 0xdd:
+                return read(4);
+            }
+
+            return std::nullopt;
+        }
+
+        std::optional<std::uint64_t> integer()
+        {
+            const auto type = read(1);
+
+            if (!type)
+            {
+                return std::nullopt;
+            }
+
+            if (*type < 0x80)
+            {
+                return type;
+            }
+
+            switch (*type)
+            {
+            case 0xcc:
+                return read(1);
+            case 0xcd:
+                return read(2);
+            case 0xce:
+                return read(4);
+            case 0xcf:
+                return read(8);
+            }
+
+            return std::nullopt;
+        }
+
+        std::optional<std::variant<std::uint64_t, std::string>> name()
+        {
+            if (m_offset >= m_data.size())
+            {
+                return std::nullopt;
+            }
+
+            const auto type = static_cast<std::uint8_t>(m_data[m_offset]);
+
+            if ((type & 0xe0) != 0xa0 && (type < 0xd9 || type > 0xdb))
+            {
+                return integer();
+            }
+
+            m_offset++;
+
+            const auto size = (type & 0xe0) == 0xa0 ? std::optional<std::uint64_t>{type & 0x1f} : read(1uz << (type - 0xd9));
+
+            if (!size || *size > m_data.size() - m_offset)
+            {
+                return std::nullopt;
+            }
+
+            auto rtn = std::string{m_data.substr(m_offset, *size)};
+            m_offset += *size;
+
+            return rtn;
+        }
+
+        bool skip()
+        {
+            // Walks the value iteratively so that deeply nested payloads can't exhaust the stack.
+
+            std::uint64_t remaining{1};
+
+            while (remaining-- > 0)
+            {
+                const auto type = read(1);
+
+                if (!type)
+                {
+                    return false;
+                }
+
+                const auto value = static_cast<std::uint8_t>(*type);
+
+                if (value < 0x80 || value >= 0xe0)
+                {
+                    continue;
+                }
+
+                if (value < 0x90)
+                {
+                    remaining += 2 * (value & 0x0f);
+                    continue;
+                }
+
+                if (value < 0xa0)
+                {
+                    remaining += value & 0x0f;
+                    continue;
+                }
+
+                if (value < 0xc0)
+                {
+                    if (!advance(value & 0x1f))
+                    {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                if (value >= 0xdc)
+                {
+                    const auto count = read(value % 2 == 0 ? 2 : 4);
+
+                    if (!count)
+                    {
+                        return false;
+                    }
+
+                    remaining += value >= 0xde ? 2 * *count : *count;
+                    continue;
+                }
+
+                std::optional<std::uint64_t> size;
+
+                switch (value)
+                {
+                case 0xc0:
+                case 0xc2:
+                case 0xc3:
+                    continue;
+                case 0xc4:
+                case 0xd9:
+                    size = read(1);
+                    break;
+                case 0xc5:
+                case 0xda:
+                    size = read(2);
+                    break;
+                case 0xc6:
+                case 0xdb:
+                    size = read(4);
+                    break;
+                case 0xc7:
+                    size = read(1).transform([](auto size) { return size + 1; });
+                    break;
+                case 0xc8:
+                    size = read(2).transform([](auto size) { return size + 1; });
+                    break;
+                case 0xc9:
+                    size = read(4).transform([](auto size) { return size + 1; });
+                    break;
+                case 0xcc:
+                case 0xd0:
+                    size = 1;
+                    break;
+                case 0xcd:
+                case 0xd1:
+                    size = 2;
+                    break;
+                case 0xca:
+                case 0xce:
+                case 0xd2:
+                    size = 4;
+                    break;
+                case 0xcb:
+                case 0xcf:
+                case 0xd3:
+                    size = 8;
+                    break;
+                case 0xd4:
+                case 0xd5:
+                case 0xd6:
+                case 0xd7:
+                case 0xd8:
+                    size = (1uz << (value - 0xd4)) + 1;
+                    break;
+                }
+
+                if (!size || !advance(*size))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    std::optional<std::string> unwrap(std::string_view data, std::string_view tag)
+    {
+        // Messages are sent as `saucer:<tag>;<base64>`, see `window.saucer.internal.msgpack.message`.
+
+        if (!data.starts_with(tag) || data.size() <= tag.size() || data[tag.size()] != ';')
+        {
+            return std::nullopt;
+        }
+
+        return impl::decode(data.substr(tag.size() + 1));
+    }
+
+    serializer::~serializer() = default;
+
+    std::string serializer::script() const
+    {
+        return std::string{codec};
+    }
+
+    std::string serializer::js_serializer() const
+    {
+        return "window.saucer.internal.msgpack.message";
+    }
+
+    std::unique_ptr<saucer::function_data> serializer::parse_call(const message &data) const
+    {
+        auto buffer = unwrap(data, "saucer:call");
+
+        if (!buffer)
+        {
+            return nullptr;
+        }
+
+        auto rtn    = std::make_unique<function_data>();
+        rtn->buffer = std::move(buffer.value());
+
+        reader parser{rtn->buffer};
+
+        auto id   = parser.array() == 3 ? parser.integer() : std::nullopt;
+        auto name = id ? parser.name() : std::nullopt;
+
+        if (!name)
+        {
+            return nullptr;
+        }
+
+        rtn->id     = id.value();
+        rtn->name   = std::move(name.value());
+        rtn->params = parser.rest();
+
+        if (!parser.skip() || parser.offset() != rtn->buffer.size())
+        {
+            return nullptr;
+        }
+
+        return rtn;
+    }
+
+    std::unique_ptr<saucer::result_data> serializer::parse_resolve(const message &data) const
+    {
+        auto buffer = unwrap(data, "saucer:resolve");
+
+        if (!buffer)
+        {
+            return nullptr;
+        }
+
+        auto rtn    = std::make_unique<result_data>();
+        rtn->buffer = std::move(buffer.value());
+
+        reader parser{rtn->buffer};
+
+        auto id = parser.array() == 2 ? parser.integer() : std::nullopt;
+
+        if (!id)
+        {
+            return nullptr;
+        }
+
+        rtn->id     = id.value();
+        rtn->result = parser.rest();
+
+        if (!parser.skip() || parser.offset() != rtn->buffer.size())
+        {
+            return nullptr;
+        }
+
+        return rtn;
+    }
+} // namespace saucer::serializers::msgpack
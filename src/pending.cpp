@@ -0,0 +1,32 @@
+#include "pending.hpp"
+
+#include <utility>
+
+namespace saucer
+{
+    bool pending_scripts::push(std::string code)
+    {
+        // Queued scripts may be evaluations or event batches someone is waiting on, so instead of silently dropping old
+        // entries, new scripts are refused once the limit is reached and the caller is expected to fail them.
+
+        if (m_size + code.size() > limit)
+        {
+            return false;
+        }
+
+        m_size += code.size();
+        m_scripts.emplace_back(std::move(code));
+
+        return true;
+    }
+
+    std::deque<std::string> pending_scripts::flush()
+    {
+        // The scripts are handed out one by one so that they can be passed to the native evaluate call individually.
+        // This way a syntax error or a throwing script does not take the rest of the queue down with it, without having
+        // to resort to `eval`, which is unavailable under a Content-Security-Policy that lacks 'unsafe-eval'.
+
+        m_size = 0;
+        return std::exchange(m_scripts, {});
+    }
+} // namespace saucer
@@ -1,5 +1,6 @@
 #include "qt.app.impl.hpp"
 
+#include <QTimer>
 #include <QThread>
 
 namespace saucer
@@ -61,6 +62,19 @@ namespace saucer
         QApplication::postEvent(m_impl->application.get(), event);
     }
 
+    void application::post(callback_t callback, std::chrono::milliseconds delay) const
+    {
+        // Timers can only be started from the thread that owns the application.
+
+        auto start = [app = m_impl->application.get(), delay, callback = std::move(callback)]() mutable
+        {
+            auto *const ptr = new callback_t{std::move(callback)};
+            QTimer::singleShot(delay, app, [ptr] { std::invoke(*std::unique_ptr<callback_t>{ptr}); });
+        };
+
+        post(std::move(start));
+    }
+
     template <>
     void application::run<true>() const // NOLINT(*-static)
     {
@@ -1,13 +1,21 @@
 #include "qt.scheme.impl.hpp"
+#include "encoding.hpp"
+#include "scheme.utils.hpp"
 
 #include <ranges>
 
+#include <cstring>
+#include <algorithm>
+
 #include <QMap>
-#include <QBuffer>
-#include <QIODevice>
 
 namespace saucer::scheme
 {
+    bool encoding::passthrough()
+    {
+        return false;
+    }
+
     request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
@@ -67,6 +75,108 @@ namespace saucer::scheme
                | std::ranges::to<std::map<std::string, std::string>>();
     }
 
+    stash_device::stash_device(stash<> data) : m_data(std::move(data))
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+    }
+
+    bool stash_device::isSequential() const
+    {
+        return false;
+    }
+
+    qint64 stash_device::size() const
+    {
+        return static_cast<qint64>(m_data.size());
+    }
+
+    qint64 stash_device::bytesAvailable() const
+    {
+        return (size() - pos()) + QIODevice::bytesAvailable();
+    }
+
+    qint64 stash_device::readData(char *data, qint64 max)
+    {
+        const auto length = std::min(max, size() - pos());
+
+        if (length <= 0)
+        {
+            return 0;
+        }
+
+        std::memcpy(data, m_data.data() + pos(), static_cast<std::size_t>(length));
+
+        return length;
+    }
+
+    qint64 stash_device::writeData(const char *, qint64)
+    {
+        return -1;
+    }
+
+    writer_device::writer_device(std::shared_ptr<writer::impl> writer) : m_writer(std::move(writer))
+    {
+        open(QIODevice::ReadOnly | QIODevice::Unbuffered);
+
+        // The writer invokes the callback with its lock held, the device can thus not be destroyed while it runs.
+
+        m_writer->subscribe([this] { QMetaObject::invokeMethod(this, [this] { notify(); }, Qt::QueuedConnection); });
+
+        if (m_writer->available() > 0 || m_writer->eof())
+        {
+            QMetaObject::invokeMethod(this, [this] { notify(); }, Qt::QueuedConnection);
+        }
+    }
+
+    writer_device::~writer_device()
+    {
+        m_writer->close();
+    }
+
+    bool writer_device::atEnd() const
+    {
+        return m_writer->eof() && QIODevice::bytesAvailable() == 0;
+    }
+
+    bool writer_device::isSequential() const
+    {
+        return true;
+    }
+
+    qint64 writer_device::bytesAvailable() const
+    {
+        return static_cast<qint64>(m_writer->available()) + QIODevice::bytesAvailable();
+    }
+
+    qint64 writer_device::readData(char *data, qint64 max)
+    {
+        const auto read = m_writer->read({reinterpret_cast<std::uint8_t *>(data), static_cast<std::size_t>(max)});
+
+        if (read == 0 && m_writer->eof())
+        {
+            return -1;
+        }
+
+        return static_cast<qint64>(read);
+    }
+
+    qint64 writer_device::writeData(const char *, qint64)
+    {
+        return -1;
+    }
+
+    void writer_device::notify()
+    {
+        emit readyRead();
+
+        if (!m_writer->eof())
+        {
+            return;
+        }
+
+        emit readChannelFinished();
+    }
+
     handler::handler(application *app, launch policy, scheme::resolver resolver)
         : app(app), policy(policy), resolver(std::move(resolver))
     {
@@ -90,16 +200,28 @@ namespace saucer::scheme
 #ifdef SAUCER_QT6
         auto *const body = raw->requestBody();
 
-        if (raw->requestBody())
+        if (body)
         {
             content = body->readAll();
         }
+#else
+        // Qt5 does not expose request bodies, uploads are refused instead of handing an empty body to the resolver.
+
+        if (const auto method = raw->requestMethod(); method == "POST" || method == "PUT")
+        {
+            return raw->fail(QWebEngineUrlRequestJob::RequestDenied);
+        }
 #endif
 
-        auto resolve = [request](const scheme::response &response)
+        auto reply = [request](scheme::response response)
         {
             const auto req = request->write();
 
+            if (!req.value() && response.stream)
+            {
+                return response.stream->native()->close();
+            }
+
             if (!req.value())
             {
                 return;
@@ -117,15 +239,27 @@ namespace saucer::scheme
             req.value()->setAdditionalResponseHeaders(converted);
 #endif
 
-            const auto data = response.data;
-            auto *buffer    = new QBuffer{};
+            // Neither device copies the body, Qt pulls from them as the page consumes data.
+
+            const auto mime = QString::fromStdString(response.mime).toUtf8();
+            auto *device    = response.stream ? static_cast<QIODevice *>(new writer_device{response.stream->native()})
+                                              : new stash_device{impl::materialize(std::move(response)).data};
+
+            connect(req.value(), &QObject::destroyed, device, &QObject::deleteLater);
+            req.value()->reply(mime, device);
+        };
 
-            buffer->open(QIODevice::WriteOnly);
-            buffer->write(reinterpret_cast<const char *>(data.data()), static_cast<std::int64_t>(data.size()));
-            buffer->close();
+        // The devices rely on queued signals and `deleteLater`, which need the event loop of the thread they live on. As
+        // the resolver may run on a pool thread (`launch::async`), the reply is always built on the GUI thread.
+
+        auto resolve = [app = app, reply](scheme::response response)
+        {
+            if (app->thread_safe())
+            {
+                return reply(std::move(response));
+            }
 
-            connect(req.value(), &QObject::destroyed, buffer, &QObject::deleteLater);
-            req.value()->reply(QString::fromStdString(response.mime).toUtf8(), buffer);
+            app->post([reply, response = std::move(response)]() mutable { reply(std::move(response)); });
         };
 
         auto reject = [request](const scheme::error &error)
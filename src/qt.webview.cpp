@@ -4,6 +4,8 @@
 #include "qt.icon.impl.hpp"
 #include "qt.window.impl.hpp"
 
+#include <utility>
+
 #include <fmt/core.h>
 #include <fmt/xchar.h>
 
@@ -14,7 +16,10 @@
 
 namespace saucer
 {
-    webview::webview(const preferences &prefs) : window(prefs), extensible(this), m_impl(std::make_unique<impl>())
+    webview::webview(const preferences &prefs)
+        : window(prefs), extensible(this), m_batch(m_parent.get(), prefs.batching, std::bind_front(&webview::settle, this)),
+          m_emitter(m_parent.get(), std::bind_front(&webview::execute, this)),
+          m_impl(std::make_unique<impl>())
     {
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
@@ -67,7 +72,11 @@ namespace saucer
         m_impl->web_view->connect(m_impl->web_view.get(), &QWebEngineView::loadStarted,
                                   [this]
                                   {
-                                      m_impl->dom_loaded = false;
+                                      if (std::exchange(m_impl->dom_loaded, false))
+                                      {
+                                          on_unload();
+                                      }
+
                                       m_events.at<web_event::load>().fire(state::started);
                                   });
 
@@ -79,6 +88,13 @@ namespace saucer
         inject({.code = impl::inject_script(), .time = load_time::creation, .permanent = true});
         inject({.code = std::string{impl::ready_script}, .time = load_time::ready, .permanent = true});
 
+        claim("saucer:emitted",
+              [this](const auto &)
+              {
+                  m_emitter.acknowledge();
+                  return true;
+              });
+
         m_impl->web_view->show();
     }
 
@@ -306,20 +322,21 @@ namespace saucer
         }
     }
 
-    void webview::execute(const std::string &code)
+    bool webview::execute(const std::string &code)
     {
         if (!m_parent->thread_safe())
         {
-            return m_parent->dispatch([this, code] { execute(code); });
+            return m_parent->dispatch([this, code] { return execute(code); });
         }
 
         if (!m_impl->dom_loaded)
         {
-            m_impl->pending.emplace_back(code);
-            return;
+            return m_impl->pending.push(code);
         }
 
         m_impl->web_view->page()->runJavaScript(QString::fromStdString(code));
+
+        return true;
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
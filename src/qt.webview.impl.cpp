@@ -65,18 +65,17 @@ namespace saucer
         {
             self.m_impl->dom_loaded = true;
 
-            for (const auto &pending : self.m_impl->pending)
+            for (const auto &script : self.m_impl->pending.flush())
             {
-                self.execute(pending);
+                self.execute(script);
             }
 
-            self.m_impl->pending.clear();
             self.m_events.at<web_event::dom_ready>().fire();
 
             return;
         }
 
-        self.on_message(message);
+        self.on_message(std::move(message));
     }
 
     template <>
@@ -38,19 +38,6 @@ consteval auto generate()
     }
 }
 
-template <typename T, typename Variant, std::size_t I = 0>
-consteval auto index_of()
-{
-    if constexpr (std::same_as<T, std::variant_alternative_t<I, Variant>>)
-    {
-        return I;
-    }
-    else
-    {
-        return index_of<T, Variant, I + 1>();
-    }
-}
-
 template <typename T, typename Named>
 constexpr auto convert(Named &&tuple)
 {
@@ -64,39 +51,23 @@ constexpr auto convert(Named &&tuple)
     return unpack(std::make_index_sequence<size>());
 }
 
-template <typename T>
-struct variants
-{
-    using type = void;
-};
-
-template <typename... Ts>
-struct variants<std::variant<Ts...>>
-{
-    using type = std::variant<typename decltype(generate<Ts>())::type...>;
-};
-
 namespace saucer
 {
-    std::optional<request::request> request::parse(const std::string &data)
+    std::optional<request::request> request::parse(std::string_view tag, std::string_view data)
     {
-        using variant       = variants<request>;
-        using named_variant = variant::type;
-
-        auto result = rfl::json::read<named_variant>(data);
-
-        if (!result)
+        auto parse = [&data]<typename T>(std::type_identity<T>) -> std::optional<T>
         {
-            return std::nullopt;
-        }
+            using named = decltype(generate<T>())::type;
+            auto result = rfl::json::read<named>(data);
 
-        auto visitor = []<typename T>(T &named) -> request
-        {
-            constexpr auto index = index_of<T, named_variant>();
-            using mapped         = std::variant_alternative_t<index, request>;
-            return convert<mapped>(named);
+            if (!result)
+            {
+                return std::nullopt;
+            }
+
+            return convert<T>(result.value());
         };
 
-        return std::visit(visitor, result.value());
+        return utils::find(tag, parse);
     }
 } // namespace saucer
@@ -1,47 +1,23 @@
 #include "serializers/rflpp/rflpp.hpp"
 
-#include <expected>
+#include <utility>
+#include <optional>
 
-namespace rfl
+namespace saucer::serializers::rflpp
 {
-    using namespace saucer::serializers::rflpp;
-
-    template <>
-    struct Reflector<function_data>
+    struct call_header
     {
-        struct ReflType
-        {
-            rfl::Rename<"saucer:call", bool> tag;
-            std::uint64_t id;
-            std::string name;
-            rfl::Generic params;
-        };
-
-        static function_data to(const ReflType &v) noexcept
-        {
-            return {{v.id, v.name}, v.params};
-        }
+        rfl::Rename<"saucer:call", bool> tag;
+        std::uint64_t id;
+        std::variant<std::uint64_t, std::string> name;
     };
 
-    template <>
-    struct Reflector<result_data>
+    struct resolve_header
     {
-        struct ReflType
-        {
-            rfl::Rename<"saucer:resolve", bool> tag;
-            std::uint64_t id;
-            rfl::Generic result;
-        };
-
-        static result_data to(const ReflType &v) noexcept
-        {
-            return {{v.id}, v.result};
-        }
+        rfl::Rename<"saucer:resolve", bool> tag;
+        std::uint64_t id;
     };
-} // namespace rfl
 
-namespace saucer::serializers::rflpp
-{
     serializer::~serializer() = default;
 
     std::string serializer::script() const
@@ -55,30 +31,81 @@ namespace saucer::serializers::rflpp
     }
 
     template <typename T>
-    std::optional<T> parse_as(const std::string &buffer)
+    std::optional<std::pair<T, yyjson_val *>> parse_as(const std::shared_ptr<yyjson_doc> &document, const char *key)
     {
-        auto result = rfl::json::read<T>(buffer);
+        // The header is read from the parsed document, the payload is only decoded once its target type is known.
+
+        auto *root = yyjson_doc_get_root(document.get());
+
+        if (!yyjson_is_obj(root))
+        {
+            return std::nullopt;
+        }
+
+        auto *payload = yyjson_obj_get(root, key);
+        auto header   = rfl::json::read<T>(rfl::json::InputVarType{root});
 
-        if (!result)
+        if (!payload || !header)
         {
             return std::nullopt;
         }
 
-        return result.value();
+        return std::make_pair(std::move(header.value()), payload);
+    }
+
+    std::shared_ptr<yyjson_doc> parse_document(std::string_view buffer)
+    {
+        auto *document = yyjson_read(buffer.data(), buffer.size(), 0);
+
+        if (!document)
+        {
+            return nullptr;
+        }
+
+        return {document, yyjson_doc_free};
+    }
+
+    std::unique_ptr<saucer::function_data> serializer::parse_call(const message &data) const
+    {
+        auto document = parse_document(data);
+
+        if (!document)
+        {
+            return nullptr;
+        }
+
+        auto res = parse_as<call_header>(document, "params");
+
+        if (!res.has_value())
+        {
+            return nullptr;
+        }
+
+        auto &[header, params] = res.value();
+
+        auto rtn = function_data{{header.id, std::move(header.name)}, std::move(document), params};
+        return std::make_unique<function_data>(std::move(rtn));
     }
 
-    serializer::parse_result serializer::parse(const std::string &data) const
+    std::unique_ptr<saucer::result_data> serializer::parse_resolve(const message &data) const
     {
-        if (auto res = parse_as<function_data>(data); res.has_value())
+        auto document = parse_document(data);
+
+        if (!document)
         {
-            return std::make_unique<function_data>(res.value());
+            return nullptr;
         }
 
-        if (auto res = parse_as<result_data>(data); res.has_value())
+        auto res = parse_as<resolve_header>(document, "result");
+
+        if (!res.has_value())
         {
-            return std::make_unique<result_data>(res.value());
+            return nullptr;
         }
 
-        return std::monostate{};
+        auto &[header, result] = res.value();
+
+        auto rtn = result_data{{header.id}, std::move(document), result};
+        return std::make_unique<result_data>(std::move(rtn));
     }
 } // namespace saucer::serializers::rflpp
@@ -0,0 +1,58 @@
+#include "router.hpp"
+
+namespace saucer
+{
+    void router::add(std::string tag, handler callback)
+    {
+        m_routes.insert_or_assign(std::move(tag), std::move(callback));
+    }
+
+    void router::remove(std::string_view tag)
+    {
+        if (auto it = m_routes.find(tag); it != m_routes.end())
+        {
+            m_routes.erase(it);
+        }
+    }
+
+    bool router::contains(std::string_view tag) const
+    {
+        return m_routes.contains(tag);
+    }
+
+    std::optional<bool> router::route(std::string_view tag, const message &message)
+    {
+        auto it = m_routes.find(tag);
+
+        if (it == m_routes.end())
+        {
+            return std::nullopt;
+        }
+
+        return std::invoke(it->second, message);
+    }
+
+    std::optional<std::string_view> router::tag(std::string_view message)
+    {
+        // Every message sent by the bridge leads with its tag, i.e. `{"saucer:call":true,...}`.
+        // We only peek at the first key instead of parsing the whole message.
+
+        static constexpr std::string_view prefix = "saucer:";
+
+        const auto start = message.find_first_not_of("{\" \t\r\n");
+
+        if (start == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        message.remove_prefix(start);
+
+        if (!message.starts_with(prefix))
+        {
+            return std::nullopt;
+        }
+
+        return message.substr(0, message.find_first_of("\";", prefix.size()));
+    }
+} // namespace saucer
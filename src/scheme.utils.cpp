@@ -0,0 +1,256 @@
+#include "scheme.utils.hpp"
+#include "writer.impl.hpp"
+
+#include <cctype>
+#include <variant>
+#include <utility>
+#include <charconv>
+#include <algorithm>
+
+#include <fmt/core.h>
+
+namespace saucer::scheme
+{
+    namespace
+    {
+        struct byte_range
+        {
+            std::size_t first;
+            std::size_t last;
+        };
+
+        struct unsatisfiable
+        {
+        };
+
+        std::optional<std::size_t> number(std::string_view value)
+        {
+            std::size_t rtn{};
+
+            if (value.empty())
+            {
+                return std::nullopt;
+            }
+
+            if (auto [end, ec] = std::from_chars(value.begin(), value.end(), rtn); ec != std::errc{} || end != value.end())
+            {
+                return std::nullopt;
+            }
+
+            return rtn;
+        }
+
+        // Returns nothing for headers that should be ignored (malformed, multiple ranges), in which case the full content
+        // is served as per RFC 9110.
+
+        std::optional<std::variant<byte_range, unsatisfiable>> parse(std::string_view header, std::size_t size)
+        {
+            static constexpr std::string_view unit = "bytes=";
+
+            if (header.size() < unit.size() || !impl::iequals(header.substr(0, unit.size()), unit))
+            {
+                return std::nullopt;
+            }
+
+            const auto spec = header.substr(unit.size());
+            const auto dash = spec.find('-');
+
+            if (dash == std::string_view::npos || spec.find(',') != std::string_view::npos)
+            {
+                return std::nullopt;
+            }
+
+            const auto start = spec.substr(0, dash);
+            const auto end   = spec.substr(dash + 1);
+
+            if (start.empty())
+            {
+                const auto suffix = number(end);
+
+                if (!suffix)
+                {
+                    return std::nullopt;
+                }
+
+                if (suffix.value() == 0 || size == 0)
+                {
+                    return unsatisfiable{};
+                }
+
+                return byte_range{.first = size - std::min(size, suffix.value()), .last = size - 1};
+            }
+
+            const auto first = number(start);
+
+            if (first && first.value() >= size)
+            {
+                return unsatisfiable{};
+            }
+
+            const auto last = end.empty() ? std::optional{size - 1} : number(end);
+
+            if (!first || !last || last.value() < first.value())
+            {
+                return std::nullopt;
+            }
+
+            return byte_range{.first = first.value(), .last = std::min(last.value(), size - 1)};
+        }
+    } // namespace
+
+    bool impl::iequals(std::string_view a, std::string_view b)
+    {
+        auto lower = [](unsigned char c)
+        {
+            return std::tolower(c);
+        };
+
+        return std::ranges::equal(a, b, {}, lower, lower);
+    }
+
+    std::optional<std::string_view> impl::header(const std::map<std::string, std::string> &headers, std::string_view name)
+    {
+        const auto it = std::ranges::find_if(headers, [name](const auto &item) { return iequals(item.first, name); });
+
+        if (it == headers.end())
+        {
+            return std::nullopt;
+        }
+
+        return it->second;
+    }
+
+    stash<> impl::slice(stash<> data, std::size_t offset, std::size_t length)
+    {
+        struct holder
+        {
+            stash<> source;
+            std::optional<stash<>> view;
+        };
+
+        auto held = std::make_shared<holder>(std::move(data));
+        held->view.emplace(stash<>::view({held->source.data() + offset, length}));
+
+        return stash<>::shared({held, &held->view.value()});
+    }
+
+    response impl::materialize(response response)
+    {
+        if (auto ranged = std::exchange(response.ranged, std::nullopt); ranged.has_value())
+        {
+            response.data = std::invoke(ranged->read, 0, ranged->size);
+        }
+
+        return response;
+    }
+
+    response impl::apply_range(const request &request, response response)
+    {
+        if (response.stream)
+        {
+            return response;
+        }
+
+        if (response.status != 200)
+        {
+            return materialize(std::move(response));
+        }
+
+        const auto size = response.ranged ? response.ranged->size : response.data.size();
+        response.headers.emplace("Accept-Ranges", "bytes");
+
+        const auto headers = request.headers();
+        const auto range   = header(headers, "Range");
+
+        if (!range)
+        {
+            return materialize(std::move(response));
+        }
+
+        // A range is only honored if the validator in "If-Range" still matches, otherwise the content has changed and is
+        // sent in full. Weak validators never match.
+
+        if (const auto validator = header(headers, "If-Range"); validator)
+        {
+            const auto etag     = header(response.headers, "ETag");
+            const auto modified = header(response.headers, "Last-Modified");
+
+            const auto matches = validator->starts_with('"') ? etag == validator : modified == validator;
+
+            if (!matches)
+            {
+                return materialize(std::move(response));
+            }
+        }
+
+        const auto parsed = parse(range.value(), size);
+
+        if (!parsed)
+        {
+            return materialize(std::move(response));
+        }
+
+        if (std::holds_alternative<unsatisfiable>(parsed.value()))
+        {
+            response.status = 416;
+            response.data   = stash<>::empty();
+            response.ranged.reset();
+
+            response.headers.insert_or_assign("Content-Range", fmt::format("bytes */{}", size));
+
+            return response;
+        }
+
+        const auto [first, last] = std::get<byte_range>(parsed.value());
+        const auto length        = last - first + 1;
+
+        if (auto ranged = std::exchange(response.ranged, std::nullopt); ranged.has_value())
+        {
+            response.data = std::invoke(ranged->read, first, length);
+        }
+        else
+        {
+            response.data = slice(std::move(response.data), first, length);
+        }
+
+        response.status = 206;
+        response.headers.insert_or_assign("Content-Range", fmt::format("bytes {}-{}/{}", first, last, size));
+
+        return response;
+    }
+
+    executor impl::ranged(request request, executor executor)
+    {
+        auto resolve = [request = std::move(request), resolve = std::move(executor.resolve)](response response)
+        {
+            std::invoke(resolve, apply_range(request, std::move(response)));
+        };
+
+        return {std::move(resolve), std::move(executor.reject)};
+    }
+
+    executor impl::buffered(executor executor)
+    {
+        auto resolve = [resolve = std::move(executor.resolve)](response response)
+        {
+            auto stream = std::exchange(response.stream, std::nullopt);
+
+            if (!stream)
+            {
+                return std::invoke(resolve, std::move(response));
+            }
+
+            // Without native streaming support the body is handed over as a whole once the writer has finished.
+
+            auto callback = [resolve, response = std::move(response)](stash<> content) mutable
+            {
+                response.data = std::move(content);
+                std::invoke(resolve, std::move(response));
+            };
+
+            stream->native()->collect(std::move(callback));
+        };
+
+        return {std::move(resolve), std::move(executor.reject)};
+    }
+} // namespace saucer::scheme
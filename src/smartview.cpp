@@ -1,30 +1,568 @@
 #include "smartview.hpp"
 
+#include "bridge.hpp"
 #include "scripts.hpp"
 
+#include "utils/hash.hpp"
+#include "utils/slots.hpp"
+#include "utils/overload.hpp"
+#include "utils/snapshot.hpp"
+
+#include <map>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <limits>
+#include <ranges>
+#include <algorithm>
+#include <charconv>
+#include <condition_variable>
+
 #include <lockpp/lock.hpp>
 #include <fmt/core.h>
+#include <fmt/ranges.h>
 
 namespace saucer
 {
-    using lockpp::lock;
-
     using resolver = saucer::serializer::resolver;
     using function = saucer::serializer::function;
 
     struct smartview_core::impl
     {
-        using exposed = std::shared_ptr<std::pair<function, launch>>;
+        struct callable
+        {
+            function func;
+            launch policy;
+
+          public:
+            std::shared_ptr<saucer::throttle> throttle;
+        };
+
+      public:
+        using exposed = std::shared_ptr<callable>;
+
+      public:
+        static constexpr std::int64_t window = stream_window;
+        static constexpr std::size_t backlog = stream_backlog;
+        static constexpr std::uint64_t unclaimed = std::numeric_limits<std::uint64_t>::max();
+
+      public:
+        struct evaluation
+        {
+            resolver resolve;
+            std::unique_ptr<std::stop_callback<std::function<void()>>> cancel;
+
+          public:
+            std::optional<std::chrono::steady_clock::time_point> deadline;
+        };
 
       public:
-        lock<std::unordered_map<std::string, exposed>> functions;
-        lock<std::unordered_map<std::uint64_t, resolver>> evaluations;
+        struct timer
+        {
+            using clock = std::chrono::steady_clock;
+
+          public:
+            std::mutex mutex;
+            std::condition_variable_any cv;
+            std::multimap<clock::time_point, std::uint64_t> deadlines;
+
+          public:
+            std::function<void(std::uint64_t)> expire;
+
+          public:
+            std::jthread thread;
+
+          public:
+            void schedule(std::uint64_t, clock::time_point);
+            void cancel(std::uint64_t, clock::time_point);
+
+          public:
+            void clear();
+            void run(const std::stop_token &);
+        };
+
+      public:
+        struct stream
+        {
+            std::uint64_t id;
+            std::function<void(std::string)> send;
+
+          public:
+            std::mutex mutex;
+
+          public:
+            std::int64_t credits{window};
+            std::deque<std::string> pending;
+            std::optional<std::string> terminal;
+
+          public:
+            bool closed{false};
+
+          public:
+            stream_status push(std::string);
+            bool close(std::string);
+            bool grant(std::int64_t);
+        };
+
+      public:
+        struct registry
+        {
+            string_map<std::size_t> handles;
+
+          public:
+            std::vector<exposed> functions;
+            std::vector<std::string> names;
+
+          public:
+            [[nodiscard]] exposed find(const std::variant<std::uint64_t, std::string> &) const;
+            [[nodiscard]] std::string name(const std::variant<std::uint64_t, std::string> &) const;
+
+          public:
+            [[nodiscard]] std::string table() const;
+        };
+
+      public:
+        snapshot<registry> functions;
+
+      public:
+        std::atomic_uint64_t prepared{0};
+        lockpp::lock<std::map<std::uint64_t, std::string>> definitions;
+
+      public:
+        slots<evaluation> evaluations;
+        timer timeouts;
+
+      public:
+        std::atomic_uint64_t stream_ids{0};
+        lockpp::lock<std::unordered_map<std::uint64_t, std::shared_ptr<stream>>> streams;
+
+      public:
+        std::shared_ptr<bridge::blobs> blobs{std::make_shared<bridge::blobs>()};
 
       public:
         std::unique_ptr<saucer::serializer> serializer;
         std::shared_ptr<lockpp::lock<smartview_core *>> self;
+
+      public:
+        std::optional<evaluation> take(std::uint64_t);
+
+      public:
+        static void fail(smartview_core *, std::uint64_t, std::string);
+        static std::optional<std::pair<std::uint64_t, std::int64_t>> credit(std::string_view);
+
+      public:
+        static serializer::channel open(smartview_core *, std::uint64_t);
+        static serializer::executor settle(serializer::executor, throttle::done);
+        static void serve(bridge::blobs &, const scheme::request &, const scheme::executor &);
     };
 
+    void smartview_core::impl::timer::schedule(std::uint64_t id, clock::time_point deadline)
+    {
+        {
+            std::lock_guard guard{mutex};
+
+            deadlines.emplace(deadline, id);
+
+            if (!thread.joinable())
+            {
+                thread = std::jthread{[this](const std::stop_token &token) { run(token); }};
+            }
+        }
+
+        cv.notify_one();
+    }
+
+    void smartview_core::impl::timer::cancel(std::uint64_t id, clock::time_point deadline)
+    {
+        std::lock_guard guard{mutex};
+
+        auto [begin, end] = deadlines.equal_range(deadline);
+        auto it           = std::find_if(begin, end, [id](const auto &entry) { return entry.second == id; });
+
+        if (it == end)
+        {
+            return;
+        }
+
+        deadlines.erase(it);
+    }
+
+    void smartview_core::impl::timer::clear()
+    {
+        std::lock_guard guard{mutex};
+        deadlines.clear();
+    }
+
+    void smartview_core::impl::timer::run(const std::stop_token &token)
+    {
+        std::unique_lock guard{mutex};
+
+        while (!token.stop_requested())
+        {
+            if (deadlines.empty())
+            {
+                cv.wait(guard, token, [this] { return !deadlines.empty(); });
+                continue;
+            }
+
+            const auto deadline = deadlines.begin()->first;
+
+            if (deadline > clock::now())
+            {
+                // Deadlines may be cancelled while waiting, in which case the map can run empty.
+
+                auto changed = [this, deadline]
+                {
+                    return deadlines.empty() || deadlines.begin()->first < deadline;
+                };
+
+                cv.wait_until(guard, token, deadline, changed);
+                continue;
+            }
+
+            const auto id = deadlines.begin()->second;
+            deadlines.erase(deadlines.begin());
+
+            guard.unlock();
+            expire(id);
+            guard.lock();
+        }
+    }
+
+    std::optional<smartview_core::impl::evaluation> smartview_core::impl::take(std::uint64_t id)
+    {
+        auto rtn = evaluations.take(id);
+
+        // Deadlines of settled evaluations are removed right away, as ids are eventually reused a stale deadline could
+        // otherwise fail an unrelated evaluation.
+
+        if (rtn && rtn->deadline)
+        {
+            timeouts.cancel(id, rtn->deadline.value());
+        }
+
+        return rtn;
+    }
+
+    void smartview_core::impl::fail(smartview_core *self, std::uint64_t id, std::string reason)
+    {
+        auto evaluation = self->m_impl->take(id);
+
+        if (!evaluation)
+        {
+            return;
+        }
+
+        std::invoke(evaluation->resolve, std::unexpected{std::move(reason)});
+    }
+
+    std::optional<std::pair<std::uint64_t, std::int64_t>> smartview_core::impl::credit(std::string_view message)
+    {
+        // Credits are sent by our own script as `{"saucer:credit":[id,amount]}` regardless of the serializer in use, they
+        // are frequent and tiny enough to not warrant a round trip through it.
+
+        const auto start = message.find('[');
+
+        if (start == std::string_view::npos)
+        {
+            return std::nullopt;
+        }
+
+        std::uint64_t id{};
+        std::int64_t amount{};
+
+        const auto *const end = message.data() + message.size();
+        const auto first      = std::from_chars(message.data() + start + 1, end, id);
+
+        if (first.ec != std::errc{} || first.ptr == end || *first.ptr != ',')
+        {
+            return std::nullopt;
+        }
+
+        const auto second = std::from_chars(first.ptr + 1, end, amount);
+
+        if (second.ec != std::errc{} || second.ptr == end || *second.ptr != ']')
+        {
+            return std::nullopt;
+        }
+
+        return std::make_pair(id, amount);
+    }
+
+    stream_status smartview_core::impl::stream::push(std::string value)
+    {
+        std::unique_lock guard{mutex};
+
+        if (closed || terminal)
+        {
+            return stream_status::closed;
+        }
+
+        // Producers never wait for credit, as that would tie up pool threads for as long as the page does not consume.
+        // Chunks are queued instead, and once the backlog is full they are refused so the producer can back off.
+
+        if (credits <= 0 && pending.size() >= backlog)
+        {
+            return stream_status::full;
+        }
+
+        auto script = fmt::format("window.saucer.internal.stream({}).push({});", id, value);
+
+        if (credits <= 0)
+        {
+            pending.emplace_back(std::move(script));
+            return stream_status::accepted;
+        }
+
+        credits--;
+        guard.unlock();
+
+        send(std::move(script));
+
+        return stream_status::accepted;
+    }
+
+    bool smartview_core::impl::stream::close(std::string script)
+    {
+        std::unique_lock guard{mutex};
+
+        if (closed || terminal)
+        {
+            return false;
+        }
+
+        if (!pending.empty())
+        {
+            terminal.emplace(std::move(script));
+            return false;
+        }
+
+        closed = true;
+        guard.unlock();
+
+        send(std::move(script));
+
+        return true;
+    }
+
+    bool smartview_core::impl::stream::grant(std::int64_t amount)
+    {
+        std::vector<std::string> scripts;
+
+        {
+            std::lock_guard guard{mutex};
+
+            if (amount < 0)
+            {
+                closed = true;
+                pending.clear();
+            }
+            else
+            {
+                credits += amount;
+            }
+
+            for (; credits > 0 && !pending.empty(); credits--)
+            {
+                scripts.emplace_back(std::move(pending.front()));
+                pending.pop_front();
+            }
+
+            if (!closed && terminal && pending.empty())
+            {
+                closed = true;
+                scripts.emplace_back(std::move(terminal.value()));
+            }
+        }
+
+        for (auto &script : scripts)
+        {
+            send(std::move(script));
+        }
+
+        return closed;
+    }
+
+    serializer::channel smartview_core::impl::open(smartview_core *self, std::uint64_t call)
+    {
+        const auto id = self->m_impl->stream_ids++;
+        auto *parent  = self->m_parent.get();
+
+        auto send = [parent, shared = self->m_impl->self](std::string script)
+        {
+            parent->post(
+                [shared, script = std::move(script)]
+                {
+                    auto self = shared->read();
+
+                    if (!self.value())
+                    {
+                        return;
+                    }
+
+                    self.value()->webview::execute(script);
+                });
+        };
+
+        auto state = std::make_shared<stream>(id, std::move(send));
+        self->m_impl->streams.write()->emplace(id, state);
+
+        self->webview::resolve(call, fmt::format("window.saucer.internal.stream({})", id));
+
+        auto release = [shared = self->m_impl->self, id]
+        {
+            auto self = shared->read();
+
+            if (!self.value())
+            {
+                return;
+            }
+
+            self.value()->m_impl->streams.write()->erase(id);
+        };
+
+        auto yield = [state](std::string value)
+        {
+            return state->push(std::move(value));
+        };
+
+        auto finish = [state, release, id]
+        {
+            if (!state->close(fmt::format("window.saucer.internal.stream({}).finish();", id)))
+            {
+                return;
+            }
+
+            release();
+        };
+
+        auto reject = [state, release, id](std::string error)
+        {
+            if (!state->close(fmt::format("window.saucer.internal.stream({}).reject({});", id, error)))
+            {
+                return;
+            }
+
+            release();
+        };
+
+        return {std::move(yield), std::move(finish), std::move(reject)};
+    }
+
+    serializer::executor smartview_core::impl::settle(serializer::executor executor, throttle::done done)
+    {
+        auto resolve = [resolve = std::move(executor.resolve), done](std::string result)
+        {
+            std::invoke(resolve, std::move(result));
+            std::invoke(done);
+        };
+
+        auto reject = [reject = std::move(executor.reject), done](std::string error)
+        {
+            std::invoke(reject, std::move(error));
+            std::invoke(done);
+        };
+
+        auto open = [open = std::move(executor.open), done]
+        {
+            auto channel = std::invoke(open);
+
+            auto finish = [finish = std::move(channel.finish), done]
+            {
+                std::invoke(finish);
+                std::invoke(done);
+            };
+
+            auto reject = [reject = std::move(channel.reject), done](std::string error)
+            {
+                std::invoke(reject, std::move(error));
+                std::invoke(done);
+            };
+
+            return serializer::channel{std::move(channel.yield), std::move(finish), std::move(reject)};
+        };
+
+        return {{std::move(resolve), std::move(reject)}, std::move(open)};
+    }
+
+    smartview_core::impl::exposed smartview_core::impl::registry::find(
+        const std::variant<std::uint64_t, std::string> &name) const
+    {
+        overload visitor = {
+            [this](std::uint64_t handle) -> exposed { return handle < functions.size() ? functions[handle] : nullptr; },
+            [this](const std::string &key) -> exposed
+            {
+                const auto it = handles.find(key);
+                return it != handles.end() ? functions[it->second] : nullptr;
+            },
+        };
+
+        return std::visit(visitor, name);
+    }
+
+    std::string smartview_core::impl::registry::name(const std::variant<std::uint64_t, std::string> &name) const
+    {
+        overload visitor = {
+            [this](std::uint64_t handle) { return handle < names.size() ? names[handle] : fmt::format("{}", handle); },
+            [](const std::string &key) { return key; },
+        };
+
+        return std::visit(visitor, name);
+    }
+
+    std::string smartview_core::impl::registry::table() const
+    {
+        auto entry = [](const auto &item)
+        {
+            return fmt::format("handles[{:?}] = {};", item.first, item.second);
+        };
+
+        return fmt::format("{{ const handles = Object.create(null); {} window.saucer.internal.handles = handles; }}",
+                           fmt::join(std::views::transform(handles, entry), " "));
+    }
+
+    void smartview_core::impl::serve(bridge::blobs &blobs, const scheme::request &request, const scheme::executor &executor)
+    {
+        static constexpr std::string_view prefix = "saucer://bridge/blob";
+        static const std::map<std::string, std::string> headers = {{"Access-Control-Allow-Origin", "*"}};
+
+        const auto url = request.url();
+
+        if (!url.starts_with(prefix))
+        {
+            return executor.reject(scheme::error::not_found);
+        }
+
+        if (request.method() == "POST")
+        {
+            const auto content = request.content();
+            const auto id      = blobs.store(stash<>::from({content.data(), content.data() + content.size()}));
+
+            if (!id)
+            {
+                return executor.reject(scheme::error::denied);
+            }
+
+            return executor.resolve({.data = make_stash(id.value()), .mime = "text/plain", .headers = headers});
+        }
+
+        const auto value = std::string_view{url}.substr(prefix.size());
+
+        if (!value.starts_with('/'))
+        {
+            return executor.reject(scheme::error::invalid);
+        }
+
+        auto data = blobs.take(std::string{value.substr(1)});
+
+        if (!data)
+        {
+            return executor.reject(scheme::error::not_found);
+        }
+
+        executor.resolve({.data = std::move(data.value()), .mime = "application/octet-stream", .headers = headers});
+    }
+
     smartview_core::smartview_core(std::unique_ptr<serializer> serializer, const preferences &prefs)
         : webview(prefs), m_impl(std::make_unique<impl>())
     {
@@ -33,55 +571,131 @@ namespace saucer
         m_impl->serializer = std::move(serializer);
         m_impl->self       = std::make_shared<lockpp::lock<smartview_core *>>(this);
 
-        auto script = fmt::format(smartview_script, fmt::arg("serializer", m_impl->serializer->js_serializer()));
+        m_impl->timeouts.expire = [parent = m_parent.get(), shared = m_impl->self](std::uint64_t id)
+        {
+            parent->post(
+                [shared, id]
+                {
+                    auto self = shared->read();
+
+                    if (!self.value())
+                    {
+                        return;
+                    }
+
+                    impl::fail(self.value(), id, "Evaluation timed out");
+                });
+        };
+
+        auto script = fmt::format(smartview_script, fmt::arg("serializer", m_impl->serializer->js_serializer()),
+                                  fmt::arg("credits", impl::window));
 
         inject({.code = std::move(script), .time = load_time::creation, .permanent = true});
         inject({.code = m_impl->serializer->script(), .time = load_time::creation, .permanent = true});
+
+        handle_bridge([blobs = m_impl->blobs](const scheme::request &request, const scheme::executor &executor)
+                      { impl::serve(*blobs, request, executor); });
+
+        claim("saucer:call",
+              [this](const auto &message)
+              {
+                  auto parsed = m_impl->serializer->parse_call(message);
+
+                  if (!parsed)
+                  {
+                      return false;
+                  }
+
+                  call(std::move(parsed));
+                  return true;
+              });
+
+        claim("saucer:resolve",
+              [this](const auto &message)
+              {
+                  auto parsed = m_impl->serializer->parse_resolve(message);
+
+                  if (!parsed)
+                  {
+                      return false;
+                  }
+
+                  resolve(std::move(parsed));
+                  return true;
+              });
+
+        claim("saucer:credit",
+              [this](const auto &message)
+              {
+                  auto parsed = impl::credit(message);
+
+                  if (!parsed)
+                  {
+                      return false;
+                  }
+
+                  grant(parsed->first, parsed->second);
+                  return true;
+              });
     }
 
     smartview_core::~smartview_core()
     {
-        auto locked = m_impl->self->write();
-        *locked     = nullptr;
-    }
+        // Channels are opened while holding `self`, resetting it first ensures no stream can be opened after the ones
+        // below have been closed.
 
-    bool smartview_core::on_message(const std::string &message)
-    {
-        if (webview::on_message(message))
         {
-            return true;
+            auto locked = m_impl->self->write();
+            *locked     = nullptr;
+        }
+
+        for (const auto &[id, stream] : *m_impl->streams.write())
+        {
+            stream->grant(-1);
         }
+    }
 
-        auto parsed = m_impl->serializer->parse(message);
+    void smartview_core::on_unload()
+    {
+        webview::on_unload();
 
-        overload visitor = {
-            [](std::monostate &) { return false; },
-            [this](std::unique_ptr<function_data> &parsed)
-            {
-                call(std::move(parsed));
-                return true;
-            },
-            [this](std::unique_ptr<result_data> &parsed)
-            {
-                resolve(std::move(parsed));
-                return true;
-            },
+        auto fail = [](auto evaluation)
+        {
+            std::invoke(evaluation.resolve, std::unexpected{"Page was unloaded before evaluation finished"});
         };
 
-        return std::visit(visitor, parsed);
+        m_impl->evaluations.drain(fail);
+        m_impl->timeouts.clear();
+        m_impl->blobs->clear();
+
+        // The handle table is re-sent to every new page instead of being injected once per function, calls made before
+        // it arrives simply fall back to looking up the function by name.
+
+        webview::execute(m_impl->functions.load()->table());
+
+        for (const auto &[id, script] : *m_impl->definitions.read())
+        {
+            webview::execute(script);
+        }
+
+        auto streams = std::exchange(*m_impl->streams.write(), {});
+
+        for (const auto &[id, stream] : streams)
+        {
+            stream->grant(-1);
+        }
     }
 
     void smartview_core::call(std::unique_ptr<function_data> message)
     {
-        impl::exposed exposed;
+        message->blobs = m_impl->blobs;
 
-        if (auto locked = m_impl->functions.write(); locked->contains(message->name))
-        {
-            exposed = locked->at(message->name);
-        }
-        else
+        auto exposed = m_impl->functions.load()->find(message->name);
+
+        if (!exposed)
         {
-            return reject(message->id, fmt::format("\"No exposed function '{}'\"", message->name));
+            auto name = m_impl->functions.load()->name(message->name);
+            return reject(message->id, fmt::format("\"No exposed function '{}'\"", name));
         }
 
         auto resolve = [shared = m_impl->self, id = message->id](const auto &result)
@@ -108,66 +722,281 @@ namespace saucer
             self.value()->reject(id, error);
         };
 
-        auto executor     = serializer::executor{std::move(resolve), std::move(reject)};
-        const auto policy = exposed->second;
+        auto open = [shared = m_impl->self, id = message->id]
+        {
+            auto self = shared->read();
 
-        if (policy == launch::sync)
+            if (!self.value())
+            {
+                return serializer::channel{[](auto &&) { return false; }, [] {}, [](auto &&) {}};
+            }
+
+            return impl::open(self.value(), id);
+        };
+
+        auto executor = serializer::executor{{std::move(resolve), std::move(reject)}, std::move(open)};
+
+        if (auto throttle = exposed->throttle; throttle)
+        {
+            auto task = [exposed = std::move(exposed), message = std::move(message), executor](throttle::done done) mutable
+            {
+                std::invoke(exposed->func, std::move(message), impl::settle(std::move(executor), std::move(done)));
+            };
+
+            auto rejected = [reject = executor.reject]
+            {
+                std::invoke(reject, "\"Too many pending calls\"");
+            };
+
+            return throttle->submit(std::move(task), std::move(rejected));
+        }
+
+        if (exposed->policy == launch::sync)
         {
-            return std::invoke(exposed->first, std::move(message), executor);
+            return std::invoke(exposed->func, std::move(message), executor);
         }
 
         m_parent->pool().emplace(
             [exposed = std::move(exposed), message = std::move(message), executor = std::move(executor)]() mutable
-            { std::invoke(exposed->first, std::move(message), executor); });
+            { std::invoke(exposed->func, std::move(message), executor); });
     }
 
     void smartview_core::resolve(std::unique_ptr<result_data> message)
     {
-        const auto id = message->id;
-        auto evals    = m_impl->evaluations.write();
+        message->blobs = m_impl->blobs;
 
-        if (!evals->contains(id))
+        auto evaluation = m_impl->take(message->id);
+
+        if (!evaluation)
         {
             return;
         }
 
-        std::invoke(evals->at(id), std::move(message));
-        evals->erase(id);
+        std::invoke(evaluation->resolve, std::move(message));
     }
 
-    void smartview_core::add_function(std::string name, function &&resolve, launch policy)
+    void smartview_core::add_function(std::string name, function &&resolve, launch policy,
+                                      std::shared_ptr<throttle> limiter)
     {
-        auto functions = m_impl->functions.write();
-        functions->emplace(std::move(name), std::make_shared<impl::exposed::element_type>(std::move(resolve), policy));
+        if (!limiter && policy == launch::serial)
+        {
+            limiter = throttle::strand(m_parent.get());
+        }
+
+        auto exposed = std::make_shared<impl::callable>(std::move(resolve), policy, std::move(limiter));
+        std::optional<std::size_t> handle;
+
+        m_impl->functions.update(
+            [&](auto &registry)
+            {
+                if (registry.handles.contains(name))
+                {
+                    return;
+                }
+
+                handle = registry.functions.size();
+
+                registry.handles.emplace(name, handle.value());
+                registry.functions.emplace_back(std::move(exposed));
+                registry.names.emplace_back(name);
+            });
+
+        if (!handle)
+        {
+            return;
+        }
+
+        webview::execute(fmt::format("window.saucer.internal.handles[{:?}] = {};", name, handle.value()));
     }
 
-    void smartview_core::add_evaluation(resolver &&resolve, const std::string &code)
+    void smartview_core::add_evaluation(resolver &&resolve, const std::string &code, const evaluate_options &options)
     {
-        auto id = m_id_counter++;
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, resolve = std::move(resolve), code, options]() mutable
+                                      { return add_evaluation(std::move(resolve), code, options); });
+        }
+
+        if (options.token.stop_requested())
+        {
+            return std::invoke(resolve, std::unexpected{"Evaluation was cancelled"});
+        }
+
+        auto evaluation = impl::evaluation{std::move(resolve)};
+        auto claimed    = std::make_shared<std::atomic_uint64_t>(impl::unclaimed);
 
+        if (options.token.stop_possible())
         {
-            auto locked = m_impl->evaluations.write();
-            locked->emplace(id, std::move(resolve));
+            auto cancel = [parent = m_parent.get(), shared = m_impl->self, claimed]
+            {
+                const auto id = claimed->load();
+
+                if (id == impl::unclaimed)
+                {
+                    return;
+                }
+
+                parent->post(
+                    [shared, id]
+                    {
+                        auto self = shared->read();
+
+                        if (!self.value())
+                        {
+                            return;
+                        }
+
+                        impl::fail(self.value(), id, "Evaluation was cancelled");
+                    });
+            };
+
+            using callback    = decltype(evaluation.cancel)::element_type;
+            evaluation.cancel = std::make_unique<callback>(options.token, std::move(cancel));
         }
 
-        webview::execute(fmt::format(
+        if (options.timeout)
+        {
+            evaluation.deadline.emplace(impl::timer::clock::now() + options.timeout.value());
+        }
+
+        const auto deadline = evaluation.deadline;
+        const auto id       = m_impl->evaluations.claim(std::move(evaluation));
+
+        claimed->store(id);
+
+        if (deadline)
+        {
+            m_impl->timeouts.schedule(id, deadline.value());
+        }
+
+        if (options.token.stop_requested())
+        {
+            return impl::fail(this, id, "Evaluation was cancelled");
+        }
+
+        const auto queued = webview::execute(fmt::format(
             R"(
                 (async () =>
                     window.saucer.internal.resolve({}, {})
                 )();
             )",
             id, code));
+
+        if (queued)
+        {
+            return;
+        }
+
+        impl::fail(this, id, "Script queue is full");
+    }
+
+    void smartview_core::grant(std::uint64_t id, std::int64_t credits)
+    {
+        std::shared_ptr<impl::stream> stream;
+
+        if (auto locked = m_impl->streams.write(); locked->contains(id))
+        {
+            stream = locked->at(id);
+        }
+        else
+        {
+            return;
+        }
+
+        if (!stream->grant(credits))
+        {
+            return;
+        }
+
+        m_impl->streams.write()->erase(id);
+    }
+
+    prepared_script smartview_core::add_prepared(std::string_view code, std::size_t arity)
+    {
+        const auto id = m_impl->prepared++;
+
+        serializer::args params;
+        std::string placeholders;
+
+        for (auto i = 0uz; arity > i; ++i)
+        {
+            params.push_back(fmt::format("args[{}]", i));
+            placeholders += i == 0 ? "{}" : ", {}";
+        }
+
+        auto script = fmt::format("window.saucer.internal.prepared[{}] = async (...args) => {{ {} }};", id,
+                                  fmt::vformat(code, params));
+
+        // Like the handle table, definitions are re-sent to every new page instead of being injected, so that releasing
+        // the handle removes them for good.
+
+        m_impl->definitions.write()->emplace(id, script);
+        webview::execute(script);
+
+        auto release = [parent = m_parent.get(), shared = m_impl->self, id](const std::string *invocation)
+        {
+            delete invocation;
+
+            parent->post(
+                [shared, id]
+                {
+                    auto self = shared->read();
+
+                    if (!self.value())
+                    {
+                        return;
+                    }
+
+                    self.value()->m_impl->definitions.write()->erase(id);
+                    self.value()->webview::execute(fmt::format("delete window.saucer.internal.prepared[{}];", id));
+                });
+        };
+
+        auto *invocation = new std::string{fmt::format("window.saucer.internal.prepared[{}]({})", id, placeholders)};
+
+        return {std::shared_ptr<const std::string>{invocation, std::move(release)}};
+    }
+
+    std::optional<throttle_stats> smartview_core::stats(const std::string &name) const
+    {
+        auto exposed = m_impl->functions.load()->find(name);
+
+        if (!exposed || !exposed->throttle)
+        {
+            return std::nullopt;
+        }
+
+        return exposed->throttle->stats();
     }
 
     void smartview_core::clear_exposed()
     {
-        auto locked = m_impl->functions.write();
-        locked->clear();
+        m_impl->functions.update(
+            [](auto &registry)
+            {
+                registry.handles.clear();
+                std::ranges::fill(registry.functions, nullptr);
+            });
+
+        webview::execute("window.saucer.internal.handles = Object.create(null);");
     }
 
     void smartview_core::clear_exposed(const std::string &name)
     {
-        auto locked = m_impl->functions.write();
-        locked->erase(name);
+        m_impl->functions.update(
+            [&name](auto &registry)
+            {
+                const auto it = registry.handles.find(name);
+
+                if (it == registry.handles.end())
+                {
+                    return;
+                }
+
+                registry.functions[it->second] = nullptr;
+                registry.handles.erase(it);
+            });
+
+        webview::execute(fmt::format("delete window.saucer.internal.handles[{:?}];", name));
     }
 } // namespace saucer
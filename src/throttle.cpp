@@ -0,0 +1,185 @@
+#include "throttle.hpp"
+
+#include "app.hpp"
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <utility>
+#include <optional>
+#include <algorithm>
+
+namespace saucer
+{
+    struct throttle::impl
+    {
+        struct entry
+        {
+            throttle::task task;
+            throttle::rejector reject;
+        };
+
+      public:
+        application *app;
+        throttle_options options;
+
+      public:
+        std::mutex mutex;
+
+      public:
+        std::deque<entry> queue;
+        std::deque<entry> waiting;
+
+      public:
+        throttle_stats stats{};
+
+      public:
+        void run(const std::shared_ptr<impl> &, throttle::task);
+        void finish(const std::shared_ptr<impl> &);
+    };
+
+    void throttle::impl::run(const std::shared_ptr<impl> &self, throttle::task task)
+    {
+        // A call stays in flight until the task reports it as done, which may happen long after it returned (e.g. for
+        // functions that settle through an executor).
+
+        auto done = [self, released = std::make_shared<std::atomic_bool>(false)]
+        {
+            if (released->exchange(true))
+            {
+                return;
+            }
+
+            self->finish(self);
+        };
+
+        app->pool().emplace([task = std::move(task), done = std::move(done)]() mutable { std::invoke(task, done); });
+    }
+
+    void throttle::impl::finish(const std::shared_ptr<impl> &self)
+    {
+        std::unique_lock guard{mutex};
+
+        stats.completed++;
+
+        if (queue.empty() && waiting.empty())
+        {
+            stats.in_flight--;
+            return;
+        }
+
+        auto &source = queue.empty() ? waiting : queue;
+        auto next    = std::move(source.front());
+
+        source.pop_front();
+
+        // Calls parked by `overflow::block` move up into the queue as soon as it has room again.
+
+        while (!waiting.empty() && queue.size() < options.queue_depth)
+        {
+            queue.emplace_back(std::move(waiting.front()));
+            waiting.pop_front();
+        }
+
+        stats.queued      = queue.size();
+        stats.waiting     = waiting.size();
+        stats.peak_queued = std::max(stats.peak_queued, stats.queued);
+
+        guard.unlock();
+
+        run(self, std::move(next.task));
+    }
+
+    throttle::throttle(application *app, throttle_options options) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->app     = app;
+        m_impl->options = options;
+
+        m_impl->options.max_in_flight = std::max<std::size_t>(m_impl->options.max_in_flight, 1);
+    }
+
+    throttle::~throttle() = default;
+
+    void throttle::submit(task task, rejector reject)
+    {
+        std::unique_lock guard{m_impl->mutex};
+
+        auto &stats         = m_impl->stats;
+        const auto &options = m_impl->options;
+
+        if (stats.in_flight < options.max_in_flight)
+        {
+            stats.in_flight++;
+            guard.unlock();
+
+            return m_impl->run(m_impl, std::move(task));
+        }
+
+        // Blocked calls are parked without occupying any thread, their promise simply stays pending until there is room.
+
+        if (m_impl->queue.size() >= options.queue_depth && options.overflow == overflow::block)
+        {
+            m_impl->waiting.emplace_back(std::move(task), std::move(reject));
+            stats.waiting = m_impl->waiting.size();
+
+            return;
+        }
+
+        if (m_impl->queue.size() >= options.queue_depth && options.overflow == overflow::reject)
+        {
+            stats.rejected++;
+            guard.unlock();
+
+            return std::invoke(reject);
+        }
+
+        std::optional<impl::entry> dropped;
+
+        if (m_impl->queue.size() >= options.queue_depth && options.overflow == overflow::drop_oldest)
+        {
+            if (m_impl->queue.empty())
+            {
+                stats.rejected++;
+                guard.unlock();
+
+                return std::invoke(reject);
+            }
+
+            dropped.emplace(std::move(m_impl->queue.front()));
+            m_impl->queue.pop_front();
+
+            stats.dropped++;
+        }
+
+        m_impl->queue.emplace_back(std::move(task), std::move(reject));
+
+        stats.queued      = m_impl->queue.size();
+        stats.peak_queued = std::max(stats.peak_queued, stats.queued);
+
+        guard.unlock();
+
+        if (!dropped)
+        {
+            return;
+        }
+
+        std::invoke(dropped->reject);
+    }
+
+    throttle_stats throttle::stats() const
+    {
+        const std::lock_guard guard{m_impl->mutex};
+        return m_impl->stats;
+    }
+
+    std::shared_ptr<throttle> throttle::strand(application *app)
+    {
+        static constexpr auto options = throttle_options{
+            .max_in_flight = 1,
+            .queue_depth   = 1024,
+            .overflow      = overflow::block,
+        };
+
+        return std::make_shared<throttle>(app, options);
+    }
+} // namespace saucer
@@ -4,21 +4,34 @@
 #include <algorithm>
 
 #include <fmt/core.h>
+#include <fmt/ranges.h>
 
 namespace saucer
 {
-    bool webview::on_message(const std::string &message)
+    bool webview::on_message(const message &message)
     {
-        if (std::ranges::any_of(modules(), [&message](auto &module) { return module.template invoke<0>(message); }))
+        auto offer = [this, &message]
         {
-            return true;
+            return std::ranges::any_of(modules(), [&message](auto &module) { return module.template invoke<0>(message); });
+        };
+
+        const auto tag = router::tag(message);
+
+        if (!tag)
+        {
+            return offer();
         }
 
-        auto request = request::parse(message);
+        if (auto routed = m_router.route(tag.value(), message); routed.has_value())
+        {
+            return routed.value();
+        }
+
+        auto request = request::parse(tag.value(), message);
 
         if (!request)
         {
-            return false;
+            return offer();
         }
 
         overload visitor = {
@@ -36,64 +49,155 @@ namespace saucer
         return true;
     }
 
+    void webview::on_unload()
+    {
+        m_emitter.reset();
+    }
+
+    bool webview::settle(const std::vector<std::string> &entries)
+    {
+        return execute(fmt::format("window.saucer.internal.settle([{}]);", fmt::join(entries, ", ")));
+    }
+
     void webview::reject(std::uint64_t id, const std::string &reason)
     {
-        execute(fmt::format(
-            R"(
-                window.saucer.internal.rpc[{0}].reject({1});
-                delete window.saucer.internal.rpc[{0}];
-            )",
-            id, reason));
+        m_batch.push(fmt::format("[{}, false, {}]", id, reason));
     }
 
     void webview::resolve(std::uint64_t id, const std::string &result)
     {
-        execute(fmt::format(
-            R"(
-                window.saucer.internal.rpc[{0}].resolve({1});
-                delete window.saucer.internal.rpc[{0}];
-            )",
-            id, result));
+        m_batch.push(fmt::format("[{}, true, {}]", id, result));
     }
 
-    void webview::embed(embedded_files files, launch policy)
+    void webview::handle_saucer(launch policy)
     {
-        if (!m_parent->thread_safe())
+        auto func = [this](const scheme::request &request, const scheme::executor &executor)
         {
-            return m_parent->dispatch([this, files = std::move(files)]() mutable { return embed(std::move(files)); });
-        }
+            static constexpr std::string_view bridge = "saucer://bridge/";
+            static constexpr std::string_view prefix = "/embedded/";
 
-        m_embedded_files.merge(std::move(files));
+            const auto url = request.url();
 
-        auto func = [this](const auto &request) -> std::expected<scheme::response, scheme::error>
-        {
-            static constexpr std::string_view prefix = "/embedded/";
+            if (url.starts_with(bridge))
+            {
+                if (!m_bridge)
+                {
+                    return executor.reject(scheme::error::not_found);
+                }
+
+                if (!m_parent->thread_safe())
+                {
+                    return std::invoke(m_bridge, request, executor);
+                }
+
+                // Blob uploads may be several megabytes and are copied by the bridge, which should never happen on the
+                // main thread, even if the scheme was (re-)installed synchronously by `embed`.
+
+                auto task = [handler = m_bridge, request, executor]
+                {
+                    std::invoke(handler, request, executor);
+                };
+
+                m_parent->pool().emplace(std::move(task));
+                return;
+            }
 
-            const auto url   = request.url();
             const auto start = url.find(prefix) + prefix.size();
 
             if (start >= url.size())
             {
-                return std::unexpected{scheme::error::invalid};
+                return executor.reject(scheme::error::invalid);
             }
 
-            const auto file = url.substr(start, url.find_first_of("#?") - start);
+            const auto file     = std::string_view{url}.substr(start, url.find_first_of("#?", start) - start);
+            const auto response = m_embedded.find(file, request);
 
-            if (!m_embedded_files.contains(file))
+            if (!response)
             {
-                return std::unexpected{scheme::error::not_found};
+                return executor.reject(response.error());
             }
 
-            const auto &data = m_embedded_files.at(file);
+            executor.resolve(*response.value());
+        };
+
+        remove_scheme("saucer");
+        handle_scheme("saucer", std::move(func), policy);
+    }
+
+    scheme::resolver webview::serialize(scheme::resolver &&resolver)
+    {
+        auto strand = throttle::strand(m_parent.get());
+
+        return [strand, resolver = std::move(resolver)](scheme::request request, scheme::executor executor)
+        {
+            auto rejected = [reject = executor.reject]
+            {
+                std::invoke(reject, scheme::error::failed);
+            };
 
-            return scheme::response{
-                .data    = data.content,
-                .mime    = data.mime,
-                .headers = {{"Access-Control-Allow-Origin", "*"}},
+            auto task = [resolver, request = std::move(request), executor = std::move(executor)](throttle::done done) mutable
+            {
+                std::invoke(resolver, std::move(request), std::move(executor));
+                std::invoke(done);
             };
+
+            strand->submit(std::move(task), std::move(rejected));
         };
+    }
 
-        handle_scheme("saucer", func, policy);
+    void webview::handle_bridge(scheme::resolver &&resolver)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, resolver = std::move(resolver)] mutable
+                                      { return handle_bridge(std::move(resolver)); });
+        }
+
+        m_bridge = std::move(resolver);
+        handle_saucer(launch::async);
+    }
+
+    void webview::embed(embedded_files files, launch policy)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, files = std::move(files), policy]() mutable
+                                      { return embed(std::move(files), policy); });
+        }
+
+        m_embedded.add(std::move(files));
+        handle_saucer(policy);
+    }
+
+    void webview::claim(std::string tag, router::handler handler)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, tag = std::move(tag), handler = std::move(handler)] mutable
+                                      { return claim(std::move(tag), std::move(handler)); });
+        }
+
+        m_router.add(std::move(tag), std::move(handler));
+    }
+
+    void webview::unclaim(const std::string &tag)
+    {
+        if (!m_parent->thread_safe())
+        {
+            return m_parent->dispatch([this, tag] { return unclaim(tag); });
+        }
+
+        m_router.remove(tag);
+    }
+
+    bool webview::emit(const std::string &channel, std::string payload, coalesce policy)
+    {
+        return m_emitter.push(channel, std::move(payload), policy);
+    }
+
+    std::size_t webview::pending_events() const
+    {
+        return m_emitter.pending();
     }
 
     void webview::serve(const std::string &file)
@@ -108,7 +212,13 @@ namespace saucer
             return m_parent->dispatch([this] { return clear_embedded(); });
         }
 
-        m_embedded_files.clear();
+        m_embedded.clear();
+
+        if (m_bridge)
+        {
+            return;
+        }
+
         remove_scheme("saucer");
     }
 
@@ -119,6 +229,6 @@ namespace saucer
             return m_parent->dispatch([this, file] { return clear_embedded(file); });
         }
 
-        m_embedded_files.erase(file);
+        m_embedded.remove(file);
     }
 } // namespace saucer
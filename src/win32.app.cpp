@@ -72,6 +72,20 @@ namespace saucer
         PostMessageW(m_impl->msg_window.get(), impl::WM_SAFE_CALL, 0, reinterpret_cast<LPARAM>(message));
     }
 
+    void application::post(callback_t callback, std::chrono::milliseconds delay) const
+    {
+        // Timers belong to the thread that owns the window, the message is used as the timer id and is deleted (and
+        // thus invoked) once the timer fires.
+
+        auto start = [window = m_impl->msg_window.get(), delay, callback = std::move(callback)]() mutable
+        {
+            auto *const message = new safe_message{std::move(callback)};
+            SetTimer(window, reinterpret_cast<UINT_PTR>(message), static_cast<UINT>(delay.count()), nullptr);
+        };
+
+        post(std::move(start));
+    }
+
     template <>
     void application::run<true>() const // NOLINT(*-static)
     {
@@ -16,6 +16,14 @@ namespace saucer
 
     LRESULT CALLBACK application::impl::wnd_proc(HWND hwnd, UINT msg, WPARAM w_param, LPARAM l_param)
     {
+        if (msg == WM_TIMER)
+        {
+            KillTimer(hwnd, w_param);
+            delete reinterpret_cast<safe_message *>(w_param);
+
+            return 0;
+        }
+
         if (msg != WM_SAFE_CALL)
         {
             return DefWindowProcW(hwnd, msg, w_param, l_param);
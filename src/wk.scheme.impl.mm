@@ -1,4 +1,5 @@
 #include "wk.scheme.impl.hpp"
+#include "scheme.utils.hpp"
 
 #import <objc/objc-runtime.h>
 
@@ -95,7 +96,7 @@ void saucer::scheme::init_objc()
                 auto &[app, policy, resolver] = self->m_callbacks.at(instance);
 
                 auto req      = scheme::request{{ref}};
-                auto executor = scheme::executor{std::move(resolve), std::move(reject)};
+                auto executor = impl::ranged(req, impl::buffered({std::move(resolve), std::move(reject)}));
 
                 if (policy != launch::async)
                 {
@@ -6,6 +6,8 @@
 #include "cocoa.window.impl.hpp"
 #include "wk.navigation.impl.hpp"
 
+#include <utility>
+
 #include <fmt/core.h>
 #include <flagpp/flags.hpp>
 
@@ -207,18 +209,17 @@ namespace saucer
                                     {
                                         self.m_impl->dom_loaded = true;
 
-                                        for (const auto &pending : self.m_impl->pending)
+                                        for (const auto &script : self.m_impl->pending.flush())
                                         {
-                                            self.execute(pending);
+                                            self.execute(script);
                                         }
 
-                                        self.m_impl->pending.clear();
                                         self.m_events.at<web_event::dom_ready>().fire();
 
                                         return;
                                     }
 
-                                    self.on_message(message);
+                                    self.on_message(std::move(message));
                                 }),
                             "v@:@");
 
@@ -250,7 +251,11 @@ namespace saucer
                             imp_implementationWithBlock(
                                 [](NavigationDelegate *delegate, WKWebView *, WKNavigation *)
                                 {
-                                    delegate->m_parent->m_impl->dom_loaded = false;
+                                    if (std::exchange(delegate->m_parent->m_impl->dom_loaded, false))
+                                    {
+                                        delegate->m_parent->on_unload();
+                                    }
+
                                     delegate->m_parent->m_events.at<web_event::load>().fire(state::started);
                                 }),
                             "v@:@");
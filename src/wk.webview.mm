@@ -13,7 +13,10 @@
 
 namespace saucer
 {
-    webview::webview(const preferences &prefs) : window(prefs), extensible(this), m_impl(std::make_unique<impl>())
+    webview::webview(const preferences &prefs)
+        : window(prefs), extensible(this), m_batch(m_parent.get(), prefs.batching, std::bind_front(&webview::settle, this)),
+          m_emitter(m_parent.get(), std::bind_front(&webview::execute, this)),
+          m_impl(std::make_unique<impl>())
     {
         static std::once_flag flag;
         std::call_once(flag,
@@ -98,6 +101,13 @@ namespace saucer
 
         inject({.code = impl::inject_script(), .time = load_time::creation, .permanent = true});
         inject({.code = std::string{impl::ready_script}, .time = load_time::ready, .permanent = true});
+
+        claim("saucer:emitted",
+              [this](const auto &)
+              {
+                  m_emitter.acknowledge();
+                  return true;
+              });
     }
 
     webview::~webview()
@@ -412,7 +422,7 @@ namespace saucer
         m_impl->permanent_scripts.emplace_back(script);
     }
 
-    void webview::execute(const std::string &code)
+    bool webview::execute(const std::string &code)
     {
         const utils::autorelease_guard guard{};
 
@@ -423,11 +433,12 @@ namespace saucer
 
         if (!m_impl->dom_loaded)
         {
-            m_impl->pending.emplace_back(code);
-            return;
+            return m_impl->pending.push(code);
         }
 
         [m_impl->web_view.get() evaluateJavaScript:[NSString stringWithUTF8String:code.c_str()] completionHandler:nil];
+
+        return true;
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
@@ -1,7 +1,13 @@
 #include "wkg.scheme.impl.hpp"
+#include "encoding.hpp"
 
 namespace saucer::scheme
 {
+    bool encoding::passthrough()
+    {
+        return false;
+    }
+
     request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
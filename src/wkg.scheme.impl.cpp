@@ -1,11 +1,238 @@
 #include "wkg.scheme.impl.hpp"
 
 #include "handle.hpp"
+#include "writer.impl.hpp"
+#include "scheme.utils.hpp"
+
+#include <span>
+#include <atomic>
 
 #include <rebind/utils/enum.hpp>
 
 namespace saucer::scheme
 {
+    struct writer_stream
+    {
+        std::shared_ptr<writer::impl> writer;
+        utils::handle<GMainContext *, g_main_context_unref> context;
+
+      public:
+        std::atomic_bool scheduled{false};
+
+      public:
+        GTask *pending{nullptr};
+        GSource *cancelled{nullptr};
+        std::span<std::uint8_t> buffer;
+    };
+} // namespace saucer::scheme
+
+struct SaucerWriterStream
+{
+    GInputStream parent;
+    std::shared_ptr<saucer::scheme::writer_stream> *state;
+};
+
+struct SaucerWriterStreamClass
+{
+    GInputStreamClass parent;
+};
+
+G_DEFINE_TYPE(SaucerWriterStream, saucer_writer_stream, G_TYPE_INPUT_STREAM)
+
+static gssize saucer_writer_stream_read(GInputStream *stream, void *buffer, gsize count, GCancellable *cancellable,
+                                        GError **error)
+{
+    auto &writer     = (*reinterpret_cast<SaucerWriterStream *>(stream)->state)->writer;
+    auto *const data = static_cast<std::uint8_t *>(buffer);
+
+    // Only used for synchronous reads, WebKit itself reads asynchronously (see below) and never ends up here.
+
+    while (!g_cancellable_set_error_if_cancelled(cancellable, error))
+    {
+        if (const auto read = writer->read({data, count}); read > 0 || writer->eof())
+        {
+            return static_cast<gssize>(read);
+        }
+
+        writer->wait(std::chrono::milliseconds(100));
+    }
+
+    return -1;
+}
+
+static void saucer_writer_stream_settle(saucer::scheme::writer_stream &state, bool cancelled)
+{
+    if (!state.pending)
+    {
+        return;
+    }
+
+    const auto read = cancelled ? 0 : state.writer->read(state.buffer);
+
+    if (!cancelled && read == 0 && !state.writer->eof())
+    {
+        return;
+    }
+
+    auto *const task = std::exchange(state.pending, nullptr);
+
+    if (auto *const source = std::exchange(state.cancelled, nullptr); source)
+    {
+        g_source_destroy(source);
+        g_source_unref(source);
+    }
+
+    if (!g_task_return_error_if_cancelled(task))
+    {
+        g_task_return_int(task, static_cast<gssize>(read));
+    }
+
+    g_object_unref(task);
+}
+
+static gboolean saucer_writer_stream_notified(gpointer data)
+{
+    auto state = static_cast<std::weak_ptr<saucer::scheme::writer_stream> *>(data)->lock();
+
+    if (!state)
+    {
+        return G_SOURCE_REMOVE;
+    }
+
+    state->scheduled = false;
+    saucer_writer_stream_settle(*state, false);
+
+    return G_SOURCE_REMOVE;
+}
+
+static gboolean saucer_writer_stream_cancelled(GCancellable *, gpointer data)
+{
+    saucer_writer_stream_settle(*static_cast<saucer::scheme::writer_stream *>(data), true);
+    return G_SOURCE_REMOVE;
+}
+
+static void saucer_writer_stream_read_async(GInputStream *stream, void *buffer, gsize count, int priority,
+                                            GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data)
+{
+    auto &state = *reinterpret_cast<SaucerWriterStream *>(stream)->state;
+    auto *task  = g_task_new(stream, cancellable, callback, user_data);
+
+    g_task_set_priority(task, priority);
+
+    // Instead of parking a GIO worker until the producer writes something, the read is left pending and settled on the
+    // reading thread's main context once the writer signals new data (or the end of the stream).
+
+    if (!state->context.get())
+    {
+        state->context.reset(g_main_context_ref_thread_default());
+
+        auto notify = [weak = std::weak_ptr{state}]
+        {
+            auto locked = weak.lock();
+
+            if (!locked || locked->scheduled.exchange(true))
+            {
+                return;
+            }
+
+            auto release = [](gpointer data)
+            {
+                delete static_cast<std::weak_ptr<saucer::scheme::writer_stream> *>(data);
+            };
+
+            auto *const source = g_idle_source_new();
+
+            g_source_set_callback(source, saucer_writer_stream_notified, new std::weak_ptr{locked}, release);
+            g_source_attach(source, locked->context.get());
+            g_source_unref(source);
+        };
+
+        state->writer->subscribe(std::move(notify));
+    }
+
+    state->pending = task;
+    state->buffer  = {static_cast<std::uint8_t *>(buffer), count};
+
+    if (cancellable)
+    {
+        state->cancelled = g_cancellable_source_new(cancellable);
+
+        g_source_set_callback(state->cancelled, G_SOURCE_FUNC(saucer_writer_stream_cancelled), state.get(), nullptr);
+        g_source_attach(state->cancelled, state->context.get());
+    }
+
+    saucer_writer_stream_settle(*state, false);
+}
+
+static gssize saucer_writer_stream_read_finish(GInputStream *, GAsyncResult *result, GError **error)
+{
+    return g_task_propagate_int(G_TASK(result), error);
+}
+
+static gboolean saucer_writer_stream_close(GInputStream *stream, GCancellable *, GError **)
+{
+    (*reinterpret_cast<SaucerWriterStream *>(stream)->state)->writer->close();
+    return TRUE;
+}
+
+static void saucer_writer_stream_finalize(GObject *object)
+{
+    auto *const self = reinterpret_cast<SaucerWriterStream *>(object);
+
+    (*self->state)->writer->close();
+    delete self->state;
+
+    G_OBJECT_CLASS(saucer_writer_stream_parent_class)->finalize(object);
+}
+
+static void saucer_writer_stream_class_init(SaucerWriterStreamClass *klass)
+{
+    G_OBJECT_CLASS(klass)->finalize = saucer_writer_stream_finalize;
+
+    G_INPUT_STREAM_CLASS(klass)->read_fn     = saucer_writer_stream_read;
+    G_INPUT_STREAM_CLASS(klass)->read_async  = saucer_writer_stream_read_async;
+    G_INPUT_STREAM_CLASS(klass)->read_finish = saucer_writer_stream_read_finish;
+    G_INPUT_STREAM_CLASS(klass)->close_fn    = saucer_writer_stream_close;
+}
+
+static void saucer_writer_stream_init(SaucerWriterStream *self)
+{
+    self->state = nullptr;
+}
+
+namespace saucer::scheme
+{
+    namespace
+    {
+        std::pair<utils::g_object_ptr<GInputStream>, gssize> make_stream(scheme::response &response)
+        {
+            if (response.stream)
+            {
+                auto *const rtn = static_cast<SaucerWriterStream *>(g_object_new(saucer_writer_stream_get_type(), nullptr));
+                auto state      = std::make_shared<writer_stream>();
+
+                state->writer = response.stream->native();
+                rtn->state    = new std::shared_ptr<writer_stream>{std::move(state)};
+
+                return {utils::g_object_ptr<GInputStream>{G_INPUT_STREAM(rtn)}, -1};
+            }
+
+            // The bytes take ownership of the stash, its content is handed to WebKit without being copied.
+
+            auto *const data = new stash<>{std::move(response.data)};
+            const auto size  = static_cast<gssize>(data->size());
+
+            auto release = [](gpointer raw)
+            {
+                delete static_cast<stash<> *>(raw);
+            };
+
+            auto bytes = utils::g_bytes_ptr{g_bytes_new_with_free_func(data->data(), data->size(), release, data)};
+
+            return {utils::g_object_ptr<GInputStream>{g_memory_input_stream_new_from_bytes(bytes.get())}, size};
+        }
+    } // namespace
+
     void handler::add_callback(WebKitWebView *id, callback callback)
     {
         m_callbacks.emplace(id, std::move(callback));
@@ -26,13 +253,9 @@ namespace saucer::scheme
             return;
         }
 
-        auto resolve = [request](const scheme::response &response)
+        auto resolve = [request](scheme::response response)
         {
-            const auto data = response.data;
-            const auto size = static_cast<gssize>(data.size());
-
-            auto bytes  = utils::g_bytes_ptr{g_bytes_new(data.data(), size)};
-            auto stream = utils::g_object_ptr<GInputStream>{g_memory_input_stream_new_from_bytes(bytes.get())};
+            auto [stream, size] = make_stream(response);
 
             auto res = utils::g_object_ptr<WebKitURISchemeResponse>{webkit_uri_scheme_response_new(stream.get(), size)};
             auto *const headers = soup_message_headers_new(SOUP_MESSAGE_HEADERS_RESPONSE);
@@ -62,8 +285,8 @@ namespace saucer::scheme
 
         auto &[app, policy, resolver] = state->m_callbacks.at(identifier);
 
-        auto executor = scheme::executor{std::move(resolve), std::move(reject)};
         auto req      = scheme::request{{request}};
+        auto executor = impl::ranged(req, {std::move(resolve), std::move(reject)});
 
         if (policy != launch::async)
         {
@@ -7,11 +7,16 @@
 #include "handle.hpp"
 #include "instantiate.hpp"
 
+#include <utility>
+
 #include <fmt/core.h>
 
 namespace saucer
 {
-    webview::webview(const preferences &prefs) : window(prefs), extensible(this), m_impl(std::make_unique<impl>())
+    webview::webview(const preferences &prefs)
+        : window(prefs), extensible(this), m_batch(m_parent.get(), prefs.batching, std::bind_front(&webview::settle, this)),
+          m_emitter(m_parent.get(), std::bind_front(&webview::execute, this)),
+          m_impl(std::make_unique<impl>())
     {
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
@@ -65,19 +70,19 @@ namespace saucer
 
         auto on_message = [](WebKitWebView *, JSCValue *value, void *data)
         {
-            auto message = std::string{utils::handle<char *, g_free>{jsc_value_to_string(value)}.get()};
-            auto &self   = *reinterpret_cast<webview *>(data);
+            auto *const raw = jsc_value_to_string(value);
+            auto message    = saucer::message{raw, std::shared_ptr<char>{raw, g_free}};
+            auto &self      = *reinterpret_cast<webview *>(data);
 
-            if (message == "dom_loaded")
+            if (message.data() == "dom_loaded")
             {
                 self.m_impl->dom_loaded = true;
 
-                for (const auto &pending : self.m_impl->pending)
+                for (const auto &script : self.m_impl->pending.flush())
                 {
-                    self.execute(pending);
+                    self.execute(script);
                 }
 
-                self.m_impl->pending.clear();
                 self.m_events.at<web_event::dom_ready>().fire();
 
                 return;
@@ -109,7 +114,11 @@ namespace saucer
                 return;
             }
 
-            self->m_impl->dom_loaded = false;
+            if (std::exchange(self->m_impl->dom_loaded, false))
+            {
+                self->on_unload();
+            }
+
             self->m_events.at<web_event::load>().fire(state::started);
         };
 
@@ -150,6 +159,13 @@ namespace saucer
 
         inject({.code = impl::inject_script(), .time = load_time::creation, .permanent = true});
         inject({.code = std::string{impl::ready_script}, .time = load_time::ready, .permanent = true});
+
+        claim("saucer:emitted",
+              [this](const auto &)
+              {
+                  m_emitter.acknowledge();
+                  return true;
+              });
     }
 
     webview::~webview()
@@ -402,7 +418,7 @@ namespace saucer
         webkit_user_content_manager_add_script(manager, user_script);
     }
 
-    void webview::execute(const std::string &code)
+    bool webview::execute(const std::string &code)
     {
         if (!m_parent->thread_safe())
         {
@@ -411,11 +427,12 @@ namespace saucer
 
         if (!m_impl->dom_loaded)
         {
-            m_impl->pending.emplace_back(code);
-            return;
+            return m_impl->pending.push(code);
         }
 
         webkit_web_view_evaluate_javascript(m_impl->web_view, code.c_str(), -1, nullptr, nullptr, nullptr, nullptr, nullptr);
+
+        return true;
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
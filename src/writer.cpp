@@ -0,0 +1,243 @@
+#include "writer.impl.hpp"
+
+#include "app.hpp"
+
+#include <cstring>
+#include <optional>
+#include <utility>
+#include <algorithm>
+
+namespace saucer::scheme
+{
+    writer::writer(std::size_t capacity) : m_impl(std::make_shared<impl>())
+    {
+        m_impl->capacity = capacity;
+
+        // Once the last copy of the writer is gone nothing can be written anymore, so the stream is finished implicitly.
+        m_guard = std::shared_ptr<void>{nullptr, [state = m_impl](void *) { state->finish(); }};
+    }
+
+    bool writer::write(stash<> chunk)
+    {
+        // Producers are held back while the reader has not caught up. On the main thread, which is where most backends
+        // consume the stream, waiting would never free up space, so the chunk is buffered regardless. The same goes for
+        // streams that no reader has attached to yet (e.g. because there is no running event loop to read them).
+
+        const auto app  = application::active();
+        const auto wait = !app || !app->thread_safe();
+
+        std::unique_lock lock{m_impl->mutex};
+
+        if (wait)
+        {
+            auto ready = [this, size = chunk.size()]
+            {
+                return m_impl->closed || m_impl->finished || !m_impl->attached || !m_impl->full(size);
+            };
+
+            m_impl->cv.wait(lock, ready);
+        }
+
+        if (m_impl->closed || m_impl->finished)
+        {
+            return false;
+        }
+
+        if (chunk.size() == 0)
+        {
+            return true;
+        }
+
+        m_impl->buffered += chunk.size();
+        m_impl->chunks.emplace_back(std::move(chunk));
+
+        m_impl->cv.notify_all();
+        lock.unlock();
+
+        m_impl->signal();
+
+        return true;
+    }
+
+    void writer::finish()
+    {
+        m_impl->finish();
+    }
+
+    std::shared_ptr<writer::impl> writer::native() const
+    {
+        return m_impl;
+    }
+
+    bool writer::impl::eof()
+    {
+        const std::lock_guard guard{mutex};
+        return finished && chunks.empty();
+    }
+
+    bool writer::impl::full(std::size_t size)
+    {
+        // A chunk is always accepted into an empty buffer, no matter its size. Collected bodies are buffered as a whole.
+        return !collecting && buffered > 0 && buffered + size > capacity;
+    }
+
+    std::size_t writer::impl::available()
+    {
+        const std::lock_guard guard{mutex};
+        return buffered;
+    }
+
+    std::size_t writer::impl::read(std::span<std::uint8_t> buffer)
+    {
+        const std::lock_guard guard{mutex};
+
+        std::size_t rtn{0};
+        attached = true;
+
+        while (!chunks.empty() && rtn < buffer.size())
+        {
+            const auto &front = chunks.front();
+            const auto count  = std::min(front.size() - offset, buffer.size() - rtn);
+
+            std::memcpy(buffer.data() + rtn, front.data() + offset, count);
+
+            rtn += count;
+            offset += count;
+
+            if (offset < front.size())
+            {
+                continue;
+            }
+
+            chunks.pop_front();
+            offset = 0;
+        }
+
+        buffered -= rtn;
+
+        if (rtn > 0)
+        {
+            cv.notify_all();
+        }
+
+        return rtn;
+    }
+
+    void writer::impl::wait(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock{mutex};
+
+        attached = true;
+        cv.wait_for(lock, timeout, [this] { return !chunks.empty() || finished || closed; });
+    }
+
+    void writer::impl::finish()
+    {
+        std::function<void(stash<>)> callback;
+        std::optional<stash<>> content;
+
+        {
+            const std::lock_guard guard{mutex};
+
+            if (std::exchange(finished, true))
+            {
+                return;
+            }
+
+            cv.notify_all();
+
+            if (collector && !closed)
+            {
+                callback = std::exchange(collector, nullptr);
+                content   = take();
+            }
+        }
+
+        signal();
+
+        if (!callback)
+        {
+            return;
+        }
+
+        std::invoke(callback, std::move(content.value()));
+    }
+
+    void writer::impl::close()
+    {
+        {
+            const std::lock_guard guard{notifying};
+            notify = nullptr;
+        }
+
+        const std::lock_guard guard{mutex};
+
+        closed = true;
+
+        chunks.clear();
+        buffered = 0;
+
+        collector = nullptr;
+
+        cv.notify_all();
+    }
+
+    void writer::impl::signal()
+    {
+        const std::lock_guard guard{notifying};
+
+        if (!notify)
+        {
+            return;
+        }
+
+        std::invoke(notify);
+    }
+
+    void writer::impl::subscribe(std::function<void()> callback)
+    {
+        {
+            const std::lock_guard guard{mutex};
+            attached = true;
+        }
+
+        const std::lock_guard guard{notifying};
+        notify = std::move(callback);
+    }
+
+    void writer::impl::collect(std::function<void(stash<>)> callback)
+    {
+        std::unique_lock lock{mutex};
+
+        collecting = true;
+        cv.notify_all();
+
+        if (!finished)
+        {
+            collector = std::move(callback);
+            return;
+        }
+
+        auto content = take();
+        lock.unlock();
+
+        std::invoke(callback, std::move(content));
+    }
+
+    stash<> writer::impl::take()
+    {
+        std::vector<std::uint8_t> rtn;
+        rtn.reserve(buffered);
+
+        for (const auto &chunk : chunks)
+        {
+            rtn.insert(rtn.end(), chunk.data() + offset, chunk.data() + chunk.size());
+            offset = 0;
+        }
+
+        chunks.clear();
+        buffered = 0;
+
+        return stash<>::from(std::move(rtn));
+    }
+} // namespace saucer::scheme
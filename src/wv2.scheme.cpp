@@ -1,9 +1,16 @@
 #include "wv2.scheme.impl.hpp"
+#include "encoding.hpp"
 
 #include "win32.utils.hpp"
 
 namespace saucer::scheme
 {
+    bool encoding::passthrough()
+    {
+        // Chromium decodes scheme responses like any other network response.
+        return true;
+    }
+
     request::request(impl data) : m_impl(std::make_unique<impl>(std::move(data))) {}
 
     request::request(const request &other) : m_impl(std::make_unique<impl>(*other.m_impl)) {}
@@ -9,6 +9,7 @@
 #include "wv2.navigation.impl.hpp"
 
 #include <ranges>
+#include <utility>
 #include <cassert>
 #include <filesystem>
 
@@ -20,7 +21,10 @@
 
 namespace saucer
 {
-    webview::webview(const preferences &prefs) : window(prefs), extensible(this), m_impl(std::make_unique<impl>())
+    webview::webview(const preferences &prefs)
+        : window(prefs), extensible(this), m_batch(m_parent.get(), prefs.batching, std::bind_front(&webview::settle, this)),
+          m_emitter(m_parent.get(), std::bind_front(&webview::execute, this)),
+          m_impl(std::make_unique<impl>())
     {
         static std::once_flag flag;
         std::call_once(flag, [] { register_scheme("saucer"); });
@@ -54,7 +58,7 @@ namespace saucer
             utils::string_handle raw;
             args->TryGetWebMessageAsString(&raw.reset());
 
-            auto message = utils::narrow(raw.get());
+            auto message = saucer::message{utils::narrow(raw.get())};
             m_parent->post([this, message = std::move(message)] { on_message(message); });
 
             return S_OK;
@@ -86,7 +90,11 @@ namespace saucer
 
         auto navigation_starting = [this](auto, ICoreWebView2NavigationStartingEventArgs *args)
         {
-            m_impl->dom_loaded = false;
+            if (std::exchange(m_impl->dom_loaded, false))
+            {
+                on_unload();
+            }
+
             m_parent->post([this] { m_events.at<web_event::load>().fire(state::started); });
 
             auto request = navigation{{args}};
@@ -115,12 +123,11 @@ namespace saucer
                 execute(script.code);
             }
 
-            for (const auto &pending : m_impl->pending)
+            for (const auto &script : m_impl->pending.flush())
             {
-                execute(pending);
+                execute(script);
             }
 
-            m_impl->pending.clear();
             m_parent->post([this] { m_events.at<web_event::dom_ready>().fire(); });
 
             return S_OK;
@@ -150,6 +157,13 @@ namespace saucer
         set_dev_tools(false);
 
         inject({.code = impl::inject_script(), .time = load_time::creation, .permanent = true});
+
+        claim("saucer:emitted",
+              [this](const auto &)
+              {
+                  m_emitter.acknowledge();
+                  return true;
+              });
     }
 
     webview::~webview()
@@ -465,7 +479,7 @@ namespace saucer
                                                               Callback<ScriptInjected>(callback).Get());
     }
 
-    void webview::execute(const std::string &code)
+    bool webview::execute(const std::string &code)
     {
         if (!m_parent->thread_safe())
         {
@@ -474,11 +488,12 @@ namespace saucer
 
         if (!m_impl->dom_loaded)
         {
-            m_impl->pending.emplace_back(code);
-            return;
+            return m_impl->pending.push(code);
         }
 
         m_impl->web_view->ExecuteScript(utils::widen(code).c_str(), nullptr);
+
+        return true;
     }
 
     void webview::handle_scheme(const std::string &name, scheme::resolver &&resolver, launch policy)
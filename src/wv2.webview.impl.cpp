@@ -6,6 +6,7 @@
 #include "win32.utils.hpp"
 #include "win32.app.impl.hpp"
 #include "wv2.scheme.impl.hpp"
+#include "scheme.utils.hpp"
 
 #include <cassert>
 
@@ -235,7 +236,8 @@ namespace saucer
         auto &[resolver, policy] = scheme->second;
 
         auto req      = scheme::request{{request, content}};
-        auto executor = scheme::executor{forward(std::move(resolve)), forward(std::move(reject))};
+        auto buffered = scheme::impl::buffered({forward(std::move(resolve)), forward(std::move(reject))});
+        auto executor = scheme::impl::ranged(req, std::move(buffered));
 
         if (policy != launch::async)
         {
@@ -25,6 +25,64 @@ suite<"smartview"> smartview_suite = []
         expect(smartview->evaluate<string_vec>("Array.of({})", saucer::make_args("1", "2")).get() == string_vec{"1", "2"});
     };
 
+    "evaluate-timeout"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->set_url("https://saucer.github.io");
+
+        auto pending = smartview->evaluate<int>({.timeout = std::chrono::milliseconds(100)}, "new Promise(() => {{}})");
+        expect(throws([&pending] { pending.get(); }));
+
+        std::stop_source source;
+        auto cancelled = smartview->evaluate<int>({.token = source.get_token()}, "new Promise(() => {{}})");
+
+        source.request_stop();
+        expect(throws([&cancelled] { cancelled.get(); }));
+
+        expect(smartview->evaluate<int>({.timeout = std::chrono::milliseconds(5000)}, "10 + 5").get() == 15);
+    };
+
+    "evaluate-continuation"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->set_url("https://saucer.github.io");
+
+        std::atomic_int result{0};
+
+        smartview->evaluate<int>("10 + 5") | saucer::then([&result](int value) { result = value; });
+        wait_for([&result] { return result == 15; });
+
+        expect(result == 15);
+
+        auto all = saucer::when_all(smartview->evaluate<int>("1 + 1"), smartview->evaluate<std::string>("'C++'"));
+        expect(all.get() == std::tuple{2, std::string{"C++"}});
+
+        auto any = saucer::when_any(smartview->evaluate<int>("new Promise(() => {{}})"), smartview->evaluate<int>("5"));
+        expect(std::get<1>(any.get()) == 5);
+    };
+
+    "evaluate-prepared"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->set_url("https://saucer.github.io");
+
+        auto sum    = smartview->prepare<int, int>("return {} + {};");
+        auto concat = smartview->prepare<std::string>("window.concat = (window.concat ?? '') + {};");
+
+        for (auto i = 0; 10 > i; ++i)
+        {
+            expect(smartview->evaluate<int>(sum, i, 1).get() == i + 1);
+            smartview->execute(concat, std::to_string(i));
+        }
+
+        expect(smartview->evaluate<std::string>("window.concat").get() == "0123456789");
+
+        {
+            auto temporary = smartview->prepare<>("return 1;");
+            expect(smartview->evaluate<int>(temporary).get() == 1);
+        }
+
+        static constexpr auto count = "window.saucer.internal.prepared.filter(Boolean).length";
+        expect(smartview->evaluate<int>(count).get() == 2);
+    };
+
     "expose-basic"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
     {
         smartview->expose("sum", [](int a, int b) { //
@@ -51,6 +109,307 @@ suite<"smartview"> smartview_suite = []
         expect(smartview->evaluate<int>("await saucer.exposed.struct({})", some_struct{5}).get() == 5);
     };
 
+    "expose-batched"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("sum", [](int a, int b) { //
+            return a + b;
+        });
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            (await Promise.all([...Array(500).keys()].map(i => saucer.exposed.sum(i, 1)))).reduce((a, b) => a + b, 0)
+        )js";
+
+        expect(smartview->evaluate<int>(script).get() == 125250);
+    };
+
+    "expose-reload"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("first", [] { return 1; });
+        smartview->expose("second", [] { return 2; });
+
+        smartview->set_url("https://saucer.github.io");
+        expect(smartview->evaluate<int>("await saucer.exposed.first()").get() == 1);
+
+        smartview->clear_exposed("first");
+        smartview->expose("first", [] { return 3; });
+
+        smartview->reload();
+
+        expect(smartview->evaluate<int>("await saucer.exposed.first()").get() == 3);
+        expect(smartview->evaluate<int>("await saucer.exposed.second()").get() == 2);
+
+        smartview->clear_exposed("second");
+        smartview->reload();
+
+        static constexpr auto script = R"js(
+            await saucer.exposed.second().then(() => "", error => `${{error}}`)
+        )js";
+
+        expect(smartview->evaluate<std::string>(script).get() == "No exposed function 'second'");
+    };
+
+    "expose-coroutine"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("sub",
+                          [&smartview](int a, int b) -> saucer::task<int> { //
+                              co_return co_await smartview->evaluate_async<int>("{} - {}", a, b);
+                          });
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            (await Promise.all([...Array(100).keys()].map(i => saucer.exposed.sub(i, 1)))).reduce((a, b) => a + b, 0)
+        )js";
+
+        expect(smartview->evaluate<int>(script).get() == 4850);
+    };
+
+    "expose-coroutine-async"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose(
+            "sub",
+            [&smartview](int a, int b) -> saucer::task<int> { //
+                co_return co_await smartview->evaluate_async<int>("{} - {}", a, b);
+            },
+            saucer::launch::async);
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            (await Promise.all([...Array(100).keys()].map(i => saucer.exposed.sub(i, 1)))).reduce((a, b) => a + b, 0)
+        )js";
+
+        expect(smartview->evaluate<int>(script).get() == 4850);
+    };
+
+    "task-cross-thread"_test_async = [](const std::shared_ptr<saucer::smartview<>> &)
+    {
+        std::atomic_int settled{0};
+
+        {
+            std::vector<std::jthread> threads;
+
+            auto work = [](int value, std::vector<std::jthread> &threads) -> saucer::task<int>
+            {
+                auto resume = [&threads](auto &&callback) { threads.emplace_back(std::move(callback)); };
+                co_await saucer::impl::continuation<decltype(resume)>{std::move(resume)};
+                co_return value;
+            };
+
+            for (auto i = 0; 1000 > i; ++i)
+            {
+                work(i, threads).then([&settled, i](auto result) { settled += result.value_or(-1) == i; });
+            }
+        }
+
+        expect(settled == 1000);
+    };
+
+    "expose-throttle"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose(
+            "slow",
+            [](int value)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                return value;
+            },
+            {.max_in_flight = 1, .queue_depth = 1});
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            (await Promise.allSettled([...Array(4).keys()].map(i => saucer.exposed.slow(i))))
+                .filter(result => result.status === "rejected").length
+        )js";
+
+        expect(smartview->evaluate<int>(script).get() == 2);
+
+        wait_for([&] { return smartview->stats("slow")->completed == 2; });
+
+        const auto stats = smartview->stats("slow");
+
+        expect(stats.has_value());
+        expect(stats->rejected == 2);
+        expect(stats->completed == 2);
+    };
+
+    "expose-serial"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        std::vector<int> order;
+
+        smartview->expose(
+            "append",
+            [&order](int value)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(value % 3));
+                order.emplace_back(value);
+            },
+            saucer::launch::serial);
+
+        smartview->set_url("https://saucer.github.io");
+        smartview->evaluate<void>("await Promise.all([...Array(50).keys()].map(i => saucer.exposed.append(i)))").get();
+
+        std::vector<int> expected;
+
+        for (auto i = 0; 50 > i; ++i)
+        {
+            expected.emplace_back(i);
+        }
+
+        expect(order == expected);
+    };
+
+    "expose-binary"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("reverse", [](std::vector<std::uint8_t> data) { //
+            return std::vector<std::uint8_t>{data.rbegin(), data.rend()};
+        });
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            Array.from(await saucer.exposed.reverse(new Uint8Array([1, 2, 3, 4])))
+        )js";
+
+        expect(smartview->evaluate<std::vector<int>>(script).get() == std::vector{4, 3, 2, 1});
+    };
+
+    "expose-typed-array"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose("scale", [](saucer::typed<std::vector<float>> data) { //
+            return saucer::typed{std::vector<float>{data.value[0] * 2, data.value[1] * 2}};
+        });
+
+        smartview->expose("plain", [] { //
+            return std::vector<double>{1.5, 2.5};
+        });
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            await (async (input) => {{
+                const result = await saucer.exposed.scale(input);
+                return result instanceof Float32Array ? result : null;
+            }})({})
+        )js";
+
+        const auto input  = saucer::typed{std::vector<float>{1.5f, -2.0f}};
+        const auto result = smartview->evaluate<saucer::typed<std::vector<float>>>(script, input).get();
+
+        expect(result.value == std::vector{3.0f, -4.0f});
+        expect(smartview->evaluate<bool>("Array.isArray(await saucer.exposed.plain())").get());
+    };
+
+    "emit"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        std::vector<int> received;
+        smartview->expose("received", [&](int value) { received.emplace_back(value); });
+
+        smartview->set_url("https://saucer.github.io");
+        smartview->evaluate<void>(R"js(saucer.on("tick", value => saucer.exposed.received(value)))js").get();
+
+        // Emitting from the main thread guarantees that no flush can happen in between, so only the last value may
+        // ever reach the page.
+
+        smartview->parent().dispatch(
+            [&]
+            {
+                for (auto i = 0; 10 > i; ++i)
+                {
+                    smartview->emit("tick", i, saucer::coalesce::latest);
+                }
+            });
+
+        wait_for([&] { return !received.empty() && received.back() == 9; });
+        expect(received == std::vector{9});
+
+        wait_for([&] { return smartview->pending_events() == 0; });
+
+        const auto accepted = smartview->parent().dispatch(
+            [&]
+            {
+                std::size_t rtn{0};
+
+                for (std::size_t i = 0; saucer::emitter::limit + 1 > i; ++i)
+                {
+                    rtn += smartview->emit("flood", i) ? 1 : 0;
+                }
+
+                return rtn;
+            });
+
+        expect(accepted == saucer::emitter::limit);
+
+        wait_for([&] { return smartview->pending_events() == 0; });
+        expect(smartview->pending_events() == 0);
+    };
+
+    "expose-stream"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        smartview->expose(
+            "count",
+            [](int n, const saucer::stream<int> &stream)
+            {
+                for (auto i = 0; n > i; ++i)
+                {
+                    stream.yield(i);
+                }
+
+                stream.finish();
+            },
+            saucer::launch::async);
+
+        smartview->set_url("https://saucer.github.io");
+
+        static constexpr auto script = R"js(
+            await (async () => {
+                let sum = 0;
+
+                for await (const value of saucer.exposed.count(100)) {
+                    sum += value;
+                }
+
+                return sum;
+            })()
+        )js";
+
+        expect(smartview->evaluate<int>(script).get() == 4950);
+    };
+
+    "expose-stream-backlog"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
+    {
+        std::atomic_int accepted{-1};
+        std::atomic<saucer::stream_status> last{};
+
+        smartview->expose(
+            "flood",
+            [&accepted, &last](const saucer::stream<int> &stream)
+            {
+                auto count = 0;
+
+                for (auto i = 0; 5000 > i; ++i)
+                {
+                    last = stream.yield(i);
+                    count += last == saucer::stream_status::accepted;
+                }
+
+                accepted = count;
+            },
+            saucer::launch::async);
+
+        smartview->set_url("https://saucer.github.io");
+        smartview->execute("window.flood = saucer.exposed.flood()");
+
+        wait_for([&accepted] { return accepted >= 0; });
+        constexpr auto expected = saucer::smartview_core::stream_window + saucer::smartview_core::stream_backlog;
+
+        expect(accepted == expected) << accepted;
+        expect(last == saucer::stream_status::full);
+    };
+
     "expose-executor"_test_async = [](const std::shared_ptr<saucer::smartview<>> &smartview)
     {
         smartview->expose("sum", [](int a, int b, const saucer::executor<int> &exec) { //
@@ -140,6 +140,41 @@ suite<"webview"> webview_suite = []
         expect(not finished);
     };
 
+    "scheme_stream"_test_async = [](const auto &webview)
+    {
+        bool finished{false};
+        webview->expose("finish", [&finished] { finished = true; });
+
+        webview->handle_scheme(
+            "test",
+            [](const saucer::scheme::request &, const saucer::scheme::executor &executor)
+            {
+                saucer::scheme::writer writer;
+
+                executor.resolve({
+                    .data   = saucer::stash<>::empty(),
+                    .mime   = "text/html",
+                    .stream = writer,
+                });
+
+                for (const std::string chunk : {"<!DOCTYPE html><html><head>", "<script>saucer.exposed.finish();</script>",
+                                                "</head><body>Streamed</body></html>"})
+                {
+                    writer.write(saucer::make_stash(chunk));
+                }
+
+                writer.finish();
+            },
+            saucer::launch::async);
+
+        webview->set_url("test://stream.html");
+
+        wait_for(finished);
+        expect(finished);
+
+        webview->remove_scheme("test");
+    };
+
     "embed"_test_async = [](const auto &webview)
     {
         bool finished{false};
@@ -223,6 +258,77 @@ suite<"webview"> webview_suite = []
         expect(called == 1);
     };
 
+    "embed_range"_test_async = [](const auto &webview)
+    {
+        const std::string page    = "<!DOCTYPE html><html></html>";
+        const std::string content = "0123456789";
+
+        webview->embed({
+            {"range.html", saucer::embedded_file{.content = saucer::make_stash(page), .mime = "text/html"}},
+            {"range.txt", saucer::embedded_file{.content = saucer::make_stash(content), .mime = "text/plain"}},
+        });
+
+        webview->serve("range.html");
+
+        static constexpr auto script = R"js(
+            await (async () => {{
+                const response = await fetch("saucer://embedded/range.txt", {{ headers: {{ Range: "bytes=2-4" }} }});
+                return `${{response.status}} ${{await response.text()}}`;
+            }})()
+        )js";
+
+        expect(webview->evaluate<std::string>(script).get() == "206 234");
+    };
+
+#ifdef SAUCER_COMPRESSION
+    "embed_encoded"_test_async = [](const auto &webview)
+    {
+        const std::string page = "<!DOCTYPE html><html></html>";
+
+        // "saucer", compressed with gzip and brotli respectively.
+
+        const std::vector<std::uint8_t> gzip = {31, 139, 8,  0,  0,  0, 0, 0, 2,  3,   43, 78, 44,
+                                                77, 78,  45, 2,  0,  20, 42, 215, 40, 6,  0,  0,  0};
+        const std::vector<std::uint8_t> brotli  = {139, 2, 128, 115, 97, 117, 99, 101, 114, 3};
+        const std::vector<std::uint8_t> corrupt = {31, 139, 8, 0, 0, 0, 0, 0, 2, 3, 1, 2, 3, 4, 5, 6, 7, 8, 6, 0, 0, 0};
+
+        auto text = [](const auto &content, std::string encoding)
+        {
+            return saucer::embedded_file{
+                .content  = saucer::make_stash(content),
+                .mime     = "text/plain",
+                .encoding = std::move(encoding),
+            };
+        };
+
+        webview->embed({
+            {"encoded.html", saucer::embedded_file{.content = saucer::make_stash(page), .mime = "text/html"}},
+            {"gzip.txt", text(gzip, "gzip")},
+            {"br.txt", text(brotli, "br")},
+            {"corrupt.txt", text(corrupt, "gzip")},
+        });
+
+        webview->serve("encoded.html");
+
+        static constexpr auto script = R"js(
+            await (async () => {{
+                const read = async (file) => {{
+                    try {{
+                        const response = await fetch(`saucer://embedded/${{file}}`);
+                        return response.ok ? await response.text() : "failed";
+                    }} catch {{
+                        return "failed";
+                    }}
+                }};
+
+                return [await read("gzip.txt"), await read("br.txt"), await read("corrupt.txt")].join(" ");
+            }})()
+        )js";
+
+        expect(webview->evaluate<std::string>(script).get() == "saucer saucer failed");
+    };
+#endif
+
     "execute"_test_async = [](const auto &webview)
     {
         webview->set_url("https://cppreference.com");
@@ -232,6 +338,23 @@ suite<"webview"> webview_suite = []
         expect(webview->url().contains("github")) << webview->url();
     };
 
+    "execute_pending"_test_async = [](const auto &webview)
+    {
+        std::vector<int> ran;
+        webview->expose("ran", [&ran](int value) { ran.emplace_back(value); });
+
+        webview->set_url("https://saucer.github.io");
+
+        webview->execute("saucer.exposed.ran(1)");
+        webview->execute("this is not ( javascript");
+        webview->execute("throw new Error('expected')");
+        webview->execute("saucer.exposed.ran(2)");
+        webview->execute("saucer.exposed.ran(2)");
+
+        wait_for([&] { return ran.size() >= 3; });
+        expect(ran == std::vector{1, 2, 2});
+    };
+
     "inject"_test_async = [](const auto &webview)
     {
         std::vector<std::string> states;